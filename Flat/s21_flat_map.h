@@ -0,0 +1,451 @@
+#ifndef S21_FLAT_MAP_H
+#define S21_FLAT_MAP_H
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../Vector/s21_vector.h"
+#include "s21_flat_search.h"
+
+namespace s21 {
+
+// A Map kept as two sorted Vectors, one of keys and one of mapped values.
+// Lookups binary search the contiguous keys without touching the values,
+// so they are far more cache friendly than the tree walk, and iteration is
+// a linear scan. Inserting or erasing a single element shifts the tail and
+// is O(n); build the map with the range insert() or from_sorted() instead.
+// Iterators are random access and, as with Map, dereference to the key;
+// value() gives the mapped value. Any insertion or erasure invalidates them.
+template <typename Key, typename T>
+class FlatMap {
+  template <bool Const>
+  class FlatIterator;
+
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = FlatIterator<false>;
+  using const_iterator = FlatIterator<true>;
+  using size_type = size_t;
+
+  // CONSTRUCTORS
+  FlatMap() = default;
+
+  FlatMap(std::initializer_list<value_type> const &items) {
+    insert(items.begin(), items.end());
+  }
+
+  // Builds the map from pairs sorted by key in O(n).
+  template <typename InputIt>
+  static FlatMap from_sorted(InputIt first, InputIt last) {
+    FlatMap res;
+    res.assign_sorted(first, last);
+    return res;
+  }
+
+  // Replaces the contents with [first, last), which has to be sorted by key
+  // in ascending order; repeated keys are kept once. Throws
+  // std::invalid_argument on unsorted input and leaves the map empty.
+  template <typename InputIt>
+  void assign_sorted(InputIt first, InputIt last) {
+    clear();
+    try {
+      for (; first != last; ++first) {
+        const key_type &key = first->first;
+        if (!keys_.empty() && !(keys_.back() < key)) {
+          if (key < keys_.back()) {
+            throw std::invalid_argument("Input is not sorted");
+          }
+          continue;
+        }
+        values_.push_back(first->second);
+        keys_.push_back(key);
+      }
+    } catch (...) {
+      clear();
+      throw;
+    }
+  }
+
+  // ELEMENT ACCESS
+  T &at(const Key &key) {
+    size_type i = Find(key);
+    if (i == size()) {
+      throw std::out_of_range("Key not found in the map");
+    }
+    return values_.data()[i];
+  }
+
+  const T &at(const Key &key) const {
+    size_type i = Find(key);
+    if (i == size()) {
+      throw std::out_of_range("Key not found in the map");
+    }
+    return values_.data()[i];
+  }
+
+  T &operator[](const Key &key) { return try_emplace(key).first.value(); }
+  T &operator[](Key &&key) {
+    return try_emplace(std::move(key)).first.value();
+  }
+
+  // ITERATORS
+  iterator begin() noexcept { return At(0); }
+  iterator end() noexcept { return At(size()); }
+  const_iterator begin() const noexcept { return At(0); }
+  const_iterator end() const noexcept { return At(size()); }
+  const_iterator cbegin() const noexcept { return At(0); }
+  const_iterator cend() const noexcept { return At(size()); }
+
+  // CAPACITY
+  bool empty() const noexcept { return keys_.empty(); }
+  size_type size() const noexcept { return keys_.size(); }
+  size_type max_size() const noexcept {
+    return std::min(keys_.max_size(), values_.max_size());
+  }
+
+  void reserve(size_type count) {
+    keys_.reserve(count);
+    values_.reserve(count);
+  }
+
+  void shrink_to_fit() {
+    keys_.shrink_to_fit();
+    values_.shrink_to_fit();
+  }
+
+  // MODIFIERS
+  void clear() noexcept {
+    keys_.clear();
+    values_.clear();
+  }
+
+  // As with Map, insert() returns end() when the key is already there, while
+  // emplace() and try_emplace() return the element that blocked them.
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return NotBlocking(TryEmplace(value.first, value.second));
+  }
+
+  std::pair<iterator, bool> insert(value_type &&value) {
+    return NotBlocking(TryEmplace(value.first, std::move(value.second)));
+  }
+
+  std::pair<iterator, bool> insert(const Key &key, const T &obj) {
+    return NotBlocking(TryEmplace(key, obj));
+  }
+
+  // The hint is the position the new element would be inserted before; a
+  // right hint saves the search, a wrong one costs two comparisons.
+  iterator insert(iterator hint, const value_type &value) {
+    size_type i = Index(hint);
+    const key_type *keys = keys_.data();
+    if ((i == 0 || keys[i - 1] < value.first) &&
+        (i == size() || value.first < keys[i])) {
+      return EmplaceAt(i, value.first, value.second);
+    }
+    return TryEmplace(value.first, value.second).first;
+  }
+
+  // Inserts the pairs of [first, last) whose keys are not in the map yet;
+  // for repeated keys the first pair wins. The range is sorted once and
+  // merged with the map in one pass: O(n + m log m) for m new pairs instead
+  // of m shifts of the whole tail. The old elements are moved only when
+  // that cannot throw, so on an exception the map stays as it was.
+  template <typename InputIt>
+  void insert(InputIt first, InputIt last) {
+    Vector<std::pair<key_type, mapped_type>> batch;
+    for (; first != last; ++first) {
+      batch.emplace_back(first->first, first->second);
+    }
+    std::stable_sort(batch.begin(), batch.end(),
+                     [](const auto &a, const auto &b) {
+                       return a.first < b.first;
+                     });
+    auto batch_end = std::unique(batch.begin(), batch.end(),
+                                 [](const auto &a, const auto &b) {
+                                   return !(a.first < b.first);
+                                 });
+
+    Vector<key_type> keys;
+    Vector<mapped_type> values;
+    keys.reserve(size() + (batch_end - batch.begin()));
+    values.reserve(size() + (batch_end - batch.begin()));
+    key_type *old_keys = keys_.data();
+    mapped_type *old_values = values_.data();
+    size_type i = 0;
+    for (auto it = batch.begin(); it != batch_end; ++it) {
+      for (; i < size() && old_keys[i] < it->first; ++i) {
+        values.push_back(std::move_if_noexcept(old_values[i]));
+        keys.push_back(std::move_if_noexcept(old_keys[i]));
+      }
+      if (i == size() || it->first < old_keys[i]) {
+        values.push_back(std::move(it->second));
+        keys.push_back(std::move(it->first));
+      }
+    }
+    for (; i < size(); ++i) {
+      values.push_back(std::move_if_noexcept(old_values[i]));
+      keys.push_back(std::move_if_noexcept(old_keys[i]));
+    }
+    keys_.swap(keys);
+    values_.swap(values);
+  }
+
+  void insert(std::initializer_list<value_type> items) {
+    insert(items.begin(), items.end());
+  }
+
+  std::pair<iterator, bool> insert_or_assign(const Key &key, const T &obj) {
+    auto result = TryEmplace(key, obj);
+    if (!result.second) {
+      result.first.value() = obj;
+    }
+    return result;
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args &&...args) {
+    std::pair<key_type, mapped_type> value(std::forward<Args>(args)...);
+    return TryEmplace(std::move(value.first), std::move(value.second));
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const key_type &key, Args &&...args) {
+    return TryEmplace(key, std::forward<Args>(args)...);
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(key_type &&key, Args &&...args) {
+    return TryEmplace(std::move(key), std::forward<Args>(args)...);
+  }
+
+  void erase(iterator pos) {
+    if (pos != end()) {
+      EraseAt(Index(pos));
+    }
+  }
+
+  size_type erase(const key_type &key) {
+    size_type i = Find(key);
+    if (i == size()) {
+      return 0;
+    }
+    EraseAt(i);
+    return 1;
+  }
+
+  void swap(FlatMap &other) noexcept {
+    keys_.swap(other.keys_);
+    values_.swap(other.values_);
+  }
+
+  // Moves every element of other whose key is not in this map over here;
+  // the duplicates stay in other, as with Map::merge. Both sorted arrays
+  // are merged in one O(n + m) pass.
+  void merge(FlatMap &other) {
+    if (this == &other || other.empty()) {
+      return;
+    }
+    FlatMap merged;
+    FlatMap rest;
+    merged.reserve(size() + other.size());
+    size_type i = 0;
+    size_type j = 0;
+    while (i < size() || j < other.size()) {
+      if (j == other.size() ||
+          (i < size() && keys_.data()[i] < other.keys_.data()[j])) {
+        merged.MoveBack(*this, i++);
+      } else if (i == size() || other.keys_.data()[j] < keys_.data()[i]) {
+        merged.MoveBack(other, j++);
+      } else {
+        merged.MoveBack(*this, i++);
+        rest.MoveBack(other, j++);
+      }
+    }
+    swap(merged);
+    other.swap(rest);
+  }
+
+  // LOOKUP
+  iterator find(const Key &key) { return At(Find(key)); }
+  const_iterator find(const Key &key) const { return At(Find(key)); }
+
+  bool contains(const Key &key) const { return Find(key) != size(); }
+
+  // pretty printout
+  friend std::ostream &operator<<(std::ostream &os, const FlatMap &map) {
+    os << "FlatMap is: {";
+    for (auto it = map.cbegin(); it != map.cend(); ++it) {
+      os << (it == map.cbegin() ? "" : ", ") << it.key() << ": " << it.value();
+    }
+    return os << "}\n";
+  }
+
+ private:
+  Vector<key_type> keys_;
+  Vector<mapped_type> values_;
+
+  iterator At(size_type i) noexcept {
+    return iterator(keys_.data() + i, values_.data() + i);
+  }
+
+  const_iterator At(size_type i) const noexcept {
+    return const_iterator(keys_.data() + i, values_.data() + i);
+  }
+
+  size_type Index(const_iterator pos) const noexcept {
+    return pos.key_ - keys_.data();
+  }
+
+  size_type LowerIndex(const key_type &key) const {
+    return FlatLowerBound(keys_.data(), size(), key) - keys_.data();
+  }
+
+  // Returns the index of key, or size() when it is not there.
+  size_type Find(const key_type &key) const {
+    size_type i = LowerIndex(key);
+    return i < size() && !(key < keys_.data()[i]) ? i : size();
+  }
+
+  std::pair<iterator, bool> NotBlocking(std::pair<iterator, bool> result) {
+    if (!result.second) {
+      result.first = end();
+    }
+    return result;
+  }
+
+  template <typename K, typename... Args>
+  std::pair<iterator, bool> TryEmplace(K &&key, Args &&...args) {
+    size_type i = LowerIndex(key);
+    if (i < size() && !(key < keys_.data()[i])) {
+      return {At(i), false};
+    }
+    return {EmplaceAt(i, std::forward<K>(key), std::forward<Args>(args)...),
+            true};
+  }
+
+  // The value goes in first, so a throwing key constructor can be undone
+  // by erasing it again.
+  template <typename K, typename... Args>
+  iterator EmplaceAt(size_type i, K &&key, Args &&...args) {
+    values_.emplace(values_.cbegin() + i, std::forward<Args>(args)...);
+    try {
+      keys_.emplace(keys_.cbegin() + i, std::forward<K>(key));
+    } catch (...) {
+      values_.erase(values_.cbegin() + i);
+      throw;
+    }
+    return At(i);
+  }
+
+  void EraseAt(size_type i) {
+    keys_.erase(keys_.cbegin() + i);
+    values_.erase(values_.cbegin() + i);
+  }
+
+  void MoveBack(FlatMap &from, size_type i) {
+    values_.push_back(std::move(from.values_.data()[i]));
+    keys_.push_back(std::move(from.keys_.data()[i]));
+  }
+};
+
+template <typename Key, typename T>
+template <bool Const>
+class FlatMap<Key, T>::FlatIterator {
+  using mapped_pointer = std::conditional_t<Const, const T *, T *>;
+
+ public:
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = Key;
+  using difference_type = std::ptrdiff_t;
+  using pointer = const Key *;
+  using reference = const Key &;
+  using mapped_reference = std::conditional_t<Const, const T &, T &>;
+
+  FlatIterator() : key_(nullptr), value_(nullptr) {}
+  FlatIterator(const Key *key, mapped_pointer value)
+      : key_(key), value_(value) {}
+
+  // An iterator converts to a const_iterator.
+  template <bool C = Const, typename = std::enable_if_t<C>>
+  FlatIterator(const FlatIterator<false> &other)
+      : key_(other.key_), value_(other.value_) {}
+
+  reference operator*() const { return *key_; }
+  pointer operator->() const { return key_; }
+  reference operator[](difference_type n) const { return key_[n]; }
+
+  const Key &key() const { return *key_; }
+  mapped_reference value() const { return *value_; }
+
+  FlatIterator &operator++() { return *this += 1; }
+  FlatIterator &operator--() { return *this -= 1; }
+
+  FlatIterator operator++(int) {
+    FlatIterator tmp = *this;
+    ++*this;
+    return tmp;
+  }
+
+  FlatIterator operator--(int) {
+    FlatIterator tmp = *this;
+    --*this;
+    return tmp;
+  }
+
+  FlatIterator &operator+=(difference_type n) {
+    key_ += n;
+    value_ += n;
+    return *this;
+  }
+
+  FlatIterator &operator-=(difference_type n) { return *this += -n; }
+
+  FlatIterator operator+(difference_type n) const {
+    return FlatIterator(*this) += n;
+  }
+
+  FlatIterator operator-(difference_type n) const {
+    return FlatIterator(*this) -= n;
+  }
+
+  difference_type operator-(const FlatIterator &other) const {
+    return key_ - other.key_;
+  }
+
+  bool operator==(const FlatIterator &other) const {
+    return key_ == other.key_;
+  }
+  bool operator!=(const FlatIterator &other) const {
+    return key_ != other.key_;
+  }
+  bool operator<(const FlatIterator &other) const { return key_ < other.key_; }
+  bool operator>(const FlatIterator &other) const { return key_ > other.key_; }
+  bool operator<=(const FlatIterator &other) const {
+    return key_ <= other.key_;
+  }
+  bool operator>=(const FlatIterator &other) const {
+    return key_ >= other.key_;
+  }
+
+ private:
+  template <bool>
+  friend class FlatIterator;
+  friend class FlatMap;
+
+  const Key *key_;
+  mapped_pointer value_;
+};
+
+}  // namespace s21
+
+#endif  // S21_FLAT_MAP_H
@@ -0,0 +1,271 @@
+#include "s21_flat_map.h"
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+template <typename Key, typename T>
+void ExpectSame(const s21::FlatMap<Key, T> &flat, const std::map<Key, T> &std) {
+  ASSERT_EQ(flat.size(), std.size());
+  auto it = flat.cbegin();
+  for (const auto &[key, value] : std) {
+    EXPECT_EQ(it.key(), key);
+    EXPECT_EQ(it.value(), value);
+    ++it;
+  }
+  EXPECT_EQ(it, flat.cend());
+}
+
+// Copies and moves count down countdown and throw when it hits zero; a
+// moved-from Fragile holds -1.
+struct Fragile {
+  static inline int countdown = -1;
+
+  Fragile(int v) : value(v) {}
+  Fragile(const Fragile &other) : value(other.value) { Tick(); }
+  Fragile(Fragile &&other) : value(other.value) {
+    Tick();
+    other.value = -1;
+  }
+  Fragile &operator=(const Fragile &other) = default;
+  Fragile &operator=(Fragile &&other) {
+    value = other.value;
+    other.value = -1;
+    return *this;
+  }
+  bool operator<(const Fragile &other) const { return value < other.value; }
+
+  static void Tick() {
+    if (countdown >= 0 && countdown-- == 0) {
+      throw std::runtime_error("copy");
+    }
+  }
+
+  int value;
+};
+
+}  // namespace
+
+TEST(TestFlatMapConstructor, Empty) {
+  s21::FlatMap<int, std::string> map;
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.size(), 0U);
+  EXPECT_EQ(map.begin(), map.end());
+  EXPECT_FALSE(map.contains(1));
+}
+
+TEST(TestFlatMapConstructor, InitializerListSortsAndKeepsFirst) {
+  s21::FlatMap<int, std::string> map = {
+      {3, "three"}, {1, "one"}, {2, "two"}, {1, "uno"}};
+  ExpectSame(map, {{1, "one"}, {2, "two"}, {3, "three"}});
+}
+
+TEST(TestFlatMapConstructor, CopyAndMove) {
+  s21::FlatMap<int, std::string> map = {{1, "one"}, {2, "two"}};
+  s21::FlatMap<int, std::string> copy(map);
+  s21::FlatMap<int, std::string> moved(std::move(map));
+  ExpectSame(copy, {{1, "one"}, {2, "two"}});
+  ExpectSame(moved, {{1, "one"}, {2, "two"}});
+  EXPECT_TRUE(map.empty());
+  map = copy;
+  ExpectSame(map, {{1, "one"}, {2, "two"}});
+}
+
+TEST(TestFlatMapConstructor, FromSorted) {
+  std::vector<std::pair<int, std::string>> pairs = {
+      {1, "one"}, {2, "two"}, {2, "dos"}, {5, "five"}};
+  auto map = s21::FlatMap<int, std::string>::from_sorted(pairs.begin(),
+                                                         pairs.end());
+  ExpectSame(map, {{1, "one"}, {2, "two"}, {5, "five"}});
+}
+
+TEST(TestFlatMapConstructor, FromUnsortedThrows) {
+  std::vector<std::pair<int, int>> pairs = {{1, 1}, {3, 3}, {2, 2}};
+  s21::FlatMap<int, int> map = {{7, 7}};
+  EXPECT_THROW(map.assign_sorted(pairs.begin(), pairs.end()),
+               std::invalid_argument);
+  EXPECT_TRUE(map.empty());
+}
+
+TEST(TestFlatMapAccess, At) {
+  s21::FlatMap<int, std::string> map = {{1, "one"}, {2, "two"}};
+  EXPECT_EQ(map.at(2), "two");
+  map.at(2) = "deux";
+  const auto &cmap = map;
+  EXPECT_EQ(cmap.at(2), "deux");
+  EXPECT_THROW(map.at(3), std::out_of_range);
+  EXPECT_THROW(cmap.at(0), std::out_of_range);
+}
+
+TEST(TestFlatMapAccess, SubscriptInsertsDefault) {
+  s21::FlatMap<std::string, int> map;
+  map["b"] = 2;
+  map["a"] += 1;
+  std::string key = "c";
+  map[std::move(key)] = 3;
+  EXPECT_EQ(map["a"], 1);
+  ExpectSame(map, {{"a", 1}, {"b", 2}, {"c", 3}});
+}
+
+TEST(TestFlatMapModifiers, InsertReturnsEndOnDuplicate) {
+  s21::FlatMap<int, std::string> map;
+  auto res = map.insert({2, "two"});
+  EXPECT_TRUE(res.second);
+  EXPECT_EQ(res.first.value(), "two");
+  res = map.insert(1, "one");
+  EXPECT_TRUE(res.second);
+  EXPECT_EQ(*res.first, 1);
+  res = map.insert({2, "deux"});
+  EXPECT_FALSE(res.second);
+  EXPECT_EQ(res.first, map.end());
+  EXPECT_EQ(map.at(2), "two");
+}
+
+TEST(TestFlatMapModifiers, EmplaceReturnsBlocker) {
+  s21::FlatMap<int, std::unique_ptr<int>> map;
+  EXPECT_TRUE(map.emplace(1, std::make_unique<int>(1)).second);
+  EXPECT_TRUE(map.try_emplace(2, std::make_unique<int>(2)).second);
+  auto res = map.try_emplace(1, std::make_unique<int>(3));
+  EXPECT_FALSE(res.second);
+  EXPECT_EQ(*res.first.value(), 1);
+}
+
+TEST(TestFlatMapModifiers, InsertOrAssign) {
+  s21::FlatMap<int, std::string> map = {{1, "one"}};
+  EXPECT_FALSE(map.insert_or_assign(1, "uno").second);
+  EXPECT_TRUE(map.insert_or_assign(2, "dos").second);
+  ExpectSame(map, {{1, "uno"}, {2, "dos"}});
+}
+
+TEST(TestFlatMapModifiers, InsertWithHint) {
+  s21::FlatMap<int, int> map = {{1, 1}, {5, 5}};
+  auto it = map.insert(map.begin() + 1, {3, 3});
+  EXPECT_EQ(*it, 3);
+  it = map.insert(map.begin(), {7, 7});
+  EXPECT_EQ(*it, 7);
+  it = map.insert(map.end(), {5, 50});
+  EXPECT_EQ(it.value(), 5);
+  ExpectSame(map, {{1, 1}, {3, 3}, {5, 5}, {7, 7}});
+}
+
+TEST(TestFlatMapModifiers, InsertRangeMergesOnce) {
+  s21::FlatMap<int, std::string> map = {{2, "two"}, {4, "four"}};
+  std::vector<std::pair<int, std::string>> batch = {
+      {5, "five"}, {4, "vier"}, {1, "one"}, {5, "fuenf"}, {3, "three"}};
+  map.insert(batch.begin(), batch.end());
+  ExpectSame(map, {{1, "one"},
+                   {2, "two"},
+                   {3, "three"},
+                   {4, "four"},
+                   {5, "five"}});
+  map.insert({{0, "zero"}, {9, "nine"}});
+  EXPECT_EQ(map.size(), 7U);
+  EXPECT_EQ(map.begin().key(), 0);
+  EXPECT_EQ((map.end() - 1).value(), "nine");
+}
+
+TEST(TestFlatMapModifiers, InsertRangeThrowingMoveKeepsTheMap) {
+  std::vector<std::pair<int, Fragile>> extra = {{8, 80}, {2, 20}, {6, 60}};
+  bool done = false;
+  for (int n = 0; !done; ++n) {
+    s21::FlatMap<int, Fragile> map;
+    for (int key : {1, 3, 5, 7}) map.insert(key, Fragile(key * 10));
+    Fragile::countdown = n;
+    try {
+      map.insert(extra.begin(), extra.end());
+      done = true;
+    } catch (const std::runtime_error &) {
+    }
+    Fragile::countdown = -1;
+    std::vector<int> keys;
+    std::vector<int> values;
+    for (auto it = map.cbegin(); it != map.cend(); ++it) {
+      keys.push_back(it.key());
+      values.push_back(it.value().value);
+    }
+    if (done) {
+      EXPECT_EQ(keys, std::vector<int>({1, 2, 3, 5, 6, 7, 8}));
+      EXPECT_EQ(values, std::vector<int>({10, 20, 30, 50, 60, 70, 80}));
+    } else {
+      EXPECT_EQ(keys, std::vector<int>({1, 3, 5, 7}));
+      EXPECT_EQ(values, std::vector<int>({10, 30, 50, 70}));
+    }
+  }
+}
+
+TEST(TestFlatMapModifiers, Erase) {
+  s21::FlatMap<int, std::string> map = {{1, "one"}, {2, "two"}, {3, "three"}};
+  map.erase(map.find(2));
+  map.erase(map.end());
+  EXPECT_EQ(map.erase(3), 1U);
+  EXPECT_EQ(map.erase(4), 0U);
+  ExpectSame(map, {{1, "one"}});
+}
+
+TEST(TestFlatMapModifiers, Swap) {
+  s21::FlatMap<int, int> a = {{1, 1}};
+  s21::FlatMap<int, int> b = {{2, 2}, {3, 3}};
+  a.swap(b);
+  ExpectSame(a, {{2, 2}, {3, 3}});
+  ExpectSame(b, {{1, 1}});
+}
+
+TEST(TestFlatMapModifiers, MergeKeepsDuplicatesInOther) {
+  s21::FlatMap<int, std::string> a = {{1, "a1"}, {3, "a3"}, {5, "a5"}};
+  s21::FlatMap<int, std::string> b = {{2, "b2"}, {3, "b3"}, {6, "b6"}};
+  a.merge(b);
+  ExpectSame(a, {{1, "a1"}, {2, "b2"}, {3, "a3"}, {5, "a5"}, {6, "b6"}});
+  ExpectSame(b, {{3, "b3"}});
+  a.merge(a);
+  EXPECT_EQ(a.size(), 5U);
+}
+
+TEST(TestFlatMapIterator, RandomAccess) {
+  s21::FlatMap<int, int> map = {{1, 10}, {2, 20}, {3, 30}, {4, 40}};
+  auto it = map.begin();
+  it += 2;
+  EXPECT_EQ(*it, 3);
+  EXPECT_EQ(it[1], 4);
+  EXPECT_EQ(it - map.begin(), 2);
+  EXPECT_EQ((it--).value(), 30);
+  EXPECT_EQ(it.value(), 20);
+  it.value() = 25;
+  s21::FlatMap<int, int>::const_iterator cit = it;
+  EXPECT_EQ(cit.value(), 25);
+  EXPECT_TRUE(map.cbegin() < cit);
+  EXPECT_EQ(map.cend() - map.cbegin(), 4);
+}
+
+TEST(TestFlatMapLookup, MatchesStdMap) {
+  std::mt19937 gen(21);
+  s21::FlatMap<int, int> flat;
+  std::map<int, int> expected;
+  for (int step = 0; step < 3000; ++step) {
+    int key = gen() % 500;
+    switch (gen() % 4) {
+      case 0:
+        flat.insert(key, step);
+        expected.insert({key, step});
+        break;
+      case 1:
+        flat[key] = step;
+        expected[key] = step;
+        break;
+      case 2:
+        EXPECT_EQ(flat.erase(key), expected.erase(key));
+        break;
+      default:
+        EXPECT_EQ(flat.contains(key), expected.count(key) == 1);
+        EXPECT_EQ(flat.find(key) == flat.end(), !expected.count(key));
+    }
+  }
+  ExpectSame(flat, expected);
+}
@@ -0,0 +1,33 @@
+#ifndef S21_FLAT_SEARCH_H
+#define S21_FLAT_SEARCH_H
+
+#include <cstddef>
+
+namespace s21 {
+
+// Returns the first of the count sorted keys starting at first that is not
+// less than key, or first + count if there is none. Unlike std::lower_bound
+// the loop does not branch on the comparison: every step halves the range
+// and only decides whether its base moves, which compiles to a setcc and a
+// multiply for arithmetic keys. The number of steps depends on count alone, so
+// there are no mispredictions to pay for on random lookups. Both possible
+// next probes are prefetched, which hides most cache misses on arrays that
+// do not fit in the cache.
+template <typename Key>
+const Key *FlatLowerBound(const Key *first, size_t count, const Key &key) {
+  if (!count) {
+    return first;
+  }
+  while (count > 1) {
+    size_t half = count / 2;
+    __builtin_prefetch(first + half / 2);
+    __builtin_prefetch(first + half + half / 2);
+    first += (first[half - 1] < key) * half;
+    count -= half;
+  }
+  return first + (*first < key);
+}
+
+}  // namespace s21
+
+#endif  // S21_FLAT_SEARCH_H
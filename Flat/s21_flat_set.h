@@ -0,0 +1,228 @@
+#ifndef S21_FLAT_SET_H
+#define S21_FLAT_SET_H
+
+#include <algorithm>
+#include <initializer_list>
+#include <iostream>
+#include <stdexcept>
+#include <utility>
+
+#include "../Vector/s21_vector.h"
+#include "s21_flat_search.h"
+
+namespace s21 {
+
+// A Set kept as one sorted Vector of keys, see FlatMap. Iterators are
+// plain pointers to the keys and are invalidated by any modification.
+template <typename Key>
+class FlatSet {
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using reference = const value_type &;
+  using const_reference = const value_type &;
+  using iterator = const value_type *;
+  using const_iterator = const value_type *;
+  using size_type = size_t;
+
+  // CONSTRUCTORS
+  FlatSet() = default;
+
+  FlatSet(std::initializer_list<value_type> const &items) {
+    insert(items.begin(), items.end());
+  }
+
+  // Builds the set from keys sorted in ascending order in O(n).
+  template <typename InputIt>
+  static FlatSet from_sorted(InputIt first, InputIt last) {
+    FlatSet res;
+    res.assign_sorted(first, last);
+    return res;
+  }
+
+  // Replaces the contents with [first, last), which has to be sorted in
+  // ascending order; repeated keys are kept once. Throws
+  // std::invalid_argument on unsorted input and leaves the set empty.
+  template <typename InputIt>
+  void assign_sorted(InputIt first, InputIt last) {
+    clear();
+    try {
+      for (; first != last; ++first) {
+        if (!keys_.empty() && !(keys_.back() < *first)) {
+          if (*first < keys_.back()) {
+            throw std::invalid_argument("Input is not sorted");
+          }
+          continue;
+        }
+        keys_.push_back(*first);
+      }
+    } catch (...) {
+      clear();
+      throw;
+    }
+  }
+
+  // ITERATORS
+  iterator begin() const noexcept { return keys_.data(); }
+  iterator end() const noexcept { return keys_.data() + size(); }
+  const_iterator cbegin() const noexcept { return begin(); }
+  const_iterator cend() const noexcept { return end(); }
+
+  // CAPACITY
+  bool empty() const noexcept { return keys_.empty(); }
+  size_type size() const noexcept { return keys_.size(); }
+  size_type max_size() const noexcept { return keys_.max_size(); }
+  void reserve(size_type count) { keys_.reserve(count); }
+  void shrink_to_fit() { keys_.shrink_to_fit(); }
+
+  // MODIFIERS
+  void clear() noexcept { keys_.clear(); }
+
+  // As with Set, insert() returns end() when the key is already there, while
+  // emplace() returns the element that blocked it.
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return NotBlocking(TryEmplace(value));
+  }
+
+  std::pair<iterator, bool> insert(value_type &&value) {
+    return NotBlocking(TryEmplace(std::move(value)));
+  }
+
+  // The hint is the position the new element would be inserted before; a
+  // right hint saves the search, a wrong one costs two comparisons.
+  iterator insert(iterator hint, const value_type &value) {
+    size_type i = hint - begin();
+    const key_type *keys = keys_.data();
+    if ((i == 0 || keys[i - 1] < value) && (i == size() || value < keys[i])) {
+      return keys_.emplace(keys_.cbegin() + i, value);
+    }
+    return TryEmplace(value).first;
+  }
+
+  // Inserts the keys of [first, last) that are not in the set yet. The range
+  // is sorted once and merged with the set in one pass: O(n + m log m) for
+  // m new keys instead of m shifts of the whole tail. The old keys are moved
+  // only when that cannot throw, so on an exception the set stays as it was.
+  template <typename InputIt>
+  void insert(InputIt first, InputIt last) {
+    Vector<key_type> batch;
+    for (; first != last; ++first) {
+      batch.push_back(*first);
+    }
+    std::sort(batch.begin(), batch.end());
+    auto batch_end = std::unique(
+        batch.begin(), batch.end(),
+        [](const key_type &a, const key_type &b) { return !(a < b); });
+
+    Vector<key_type> keys;
+    keys.reserve(size() + (batch_end - batch.begin()));
+    key_type *old_keys = keys_.data();
+    size_type i = 0;
+    for (auto it = batch.begin(); it != batch_end; ++it) {
+      for (; i < size() && old_keys[i] < *it; ++i) {
+        keys.push_back(std::move_if_noexcept(old_keys[i]));
+      }
+      if (i == size() || *it < old_keys[i]) {
+        keys.push_back(std::move(*it));
+      }
+    }
+    for (; i < size(); ++i) {
+      keys.push_back(std::move_if_noexcept(old_keys[i]));
+    }
+    keys_.swap(keys);
+  }
+
+  void insert(std::initializer_list<value_type> items) {
+    insert(items.begin(), items.end());
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args &&...args) {
+    return TryEmplace(Key(std::forward<Args>(args)...));
+  }
+
+  void erase(iterator pos) {
+    if (pos != end()) {
+      keys_.erase(pos);
+    }
+  }
+
+  size_type erase(const key_type &key) {
+    iterator pos = find(key);
+    if (pos == end()) {
+      return 0;
+    }
+    keys_.erase(pos);
+    return 1;
+  }
+
+  void swap(FlatSet &other) noexcept { keys_.swap(other.keys_); }
+
+  // Moves every key of other that is not in this set over here; the
+  // duplicates stay in other, as with Set::merge. Both sorted arrays are
+  // merged in one O(n + m) pass.
+  void merge(FlatSet &other) {
+    if (this == &other || other.empty()) {
+      return;
+    }
+    Vector<key_type> merged;
+    Vector<key_type> rest;
+    merged.reserve(size() + other.size());
+    key_type *a = keys_.data();
+    key_type *b = other.keys_.data();
+    size_type i = 0;
+    size_type j = 0;
+    while (i < size() || j < other.size()) {
+      if (j == other.size() || (i < size() && a[i] < b[j])) {
+        merged.push_back(std::move(a[i++]));
+      } else if (i == size() || b[j] < a[i]) {
+        merged.push_back(std::move(b[j++]));
+      } else {
+        merged.push_back(std::move(a[i++]));
+        rest.push_back(std::move(b[j++]));
+      }
+    }
+    keys_.swap(merged);
+    other.keys_.swap(rest);
+  }
+
+  // LOOKUP
+  iterator find(const key_type &key) const {
+    iterator pos = FlatLowerBound(keys_.data(), size(), key);
+    return pos != end() && !(key < *pos) ? pos : end();
+  }
+
+  bool contains(const key_type &key) const { return find(key) != end(); }
+
+  // pretty printout
+  friend std::ostream &operator<<(std::ostream &os, const FlatSet &set) {
+    os << "FlatSet is: {";
+    for (iterator it = set.begin(); it != set.end(); ++it) {
+      os << (it == set.begin() ? "" : ", ") << *it;
+    }
+    return os << "}\n";
+  }
+
+ private:
+  Vector<key_type> keys_;
+
+  std::pair<iterator, bool> NotBlocking(std::pair<iterator, bool> result) {
+    if (!result.second) {
+      result.first = end();
+    }
+    return result;
+  }
+
+  template <typename K>
+  std::pair<iterator, bool> TryEmplace(K &&key) {
+    iterator pos = FlatLowerBound(keys_.data(), size(), key);
+    if (pos != end() && !(key < *pos)) {
+      return {pos, false};
+    }
+    return {keys_.emplace(pos, std::forward<K>(key)), true};
+  }
+};
+
+}  // namespace s21
+
+#endif  // S21_FLAT_SET_H
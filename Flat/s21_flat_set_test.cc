@@ -0,0 +1,176 @@
+#include "s21_flat_set.h"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+template <typename Key>
+void ExpectSame(const s21::FlatSet<Key> &flat, const std::set<Key> &std) {
+  ASSERT_EQ(flat.size(), std.size());
+  EXPECT_TRUE(std::equal(flat.begin(), flat.end(), std.begin()));
+}
+
+// Copies and moves count down countdown and throw when it hits zero; a
+// moved-from Fragile holds -1.
+struct Fragile {
+  static inline int countdown = -1;
+
+  Fragile(int v) : value(v) {}
+  Fragile(const Fragile &other) : value(other.value) { Tick(); }
+  Fragile(Fragile &&other) : value(other.value) {
+    Tick();
+    other.value = -1;
+  }
+  Fragile &operator=(const Fragile &other) = default;
+  Fragile &operator=(Fragile &&other) {
+    value = other.value;
+    other.value = -1;
+    return *this;
+  }
+  bool operator<(const Fragile &other) const { return value < other.value; }
+
+  static void Tick() {
+    if (countdown >= 0 && countdown-- == 0) {
+      throw std::runtime_error("copy");
+    }
+  }
+
+  int value;
+};
+
+}  // namespace
+
+TEST(TestFlatSetConstructor, Empty) {
+  s21::FlatSet<int> set;
+  EXPECT_TRUE(set.empty());
+  EXPECT_EQ(set.begin(), set.end());
+  EXPECT_FALSE(set.contains(0));
+  EXPECT_EQ(set.find(0), set.end());
+}
+
+TEST(TestFlatSetConstructor, InitializerListSortsAndDedups) {
+  s21::FlatSet<std::string> set = {"pear", "apple", "fig", "apple"};
+  ExpectSame(set, {"apple", "fig", "pear"});
+}
+
+TEST(TestFlatSetConstructor, CopyAndMove) {
+  s21::FlatSet<int> set = {3, 1, 2};
+  s21::FlatSet<int> copy(set);
+  s21::FlatSet<int> moved(std::move(set));
+  ExpectSame(copy, {1, 2, 3});
+  ExpectSame(moved, {1, 2, 3});
+  EXPECT_TRUE(set.empty());
+}
+
+TEST(TestFlatSetConstructor, FromSorted) {
+  std::vector<int> keys = {1, 2, 2, 3, 8};
+  auto set = s21::FlatSet<int>::from_sorted(keys.begin(), keys.end());
+  ExpectSame(set, {1, 2, 3, 8});
+  std::vector<int> unsorted = {1, 3, 2};
+  EXPECT_THROW(set.assign_sorted(unsorted.begin(), unsorted.end()),
+               std::invalid_argument);
+  EXPECT_TRUE(set.empty());
+}
+
+TEST(TestFlatSetModifiers, Insert) {
+  s21::FlatSet<std::string> set;
+  auto res = set.insert("b");
+  EXPECT_TRUE(res.second);
+  EXPECT_EQ(*res.first, "b");
+  std::string a = "a";
+  res = set.insert(std::move(a));
+  EXPECT_EQ(*res.first, "a");
+  res = set.insert("b");
+  EXPECT_FALSE(res.second);
+  EXPECT_EQ(res.first, set.end());
+  auto blocked = set.emplace(1, 'b');
+  EXPECT_FALSE(blocked.second);
+  EXPECT_EQ(*blocked.first, "b");
+  ExpectSame(set, {"a", "b"});
+}
+
+TEST(TestFlatSetModifiers, InsertWithHint) {
+  s21::FlatSet<int> set = {1, 5};
+  EXPECT_EQ(*set.insert(set.begin() + 1, 3), 3);
+  EXPECT_EQ(*set.insert(set.begin(), 9), 9);
+  EXPECT_EQ(*set.insert(set.end(), 1), 1);
+  ExpectSame(set, {1, 3, 5, 9});
+}
+
+TEST(TestFlatSetModifiers, InsertRange) {
+  s21::FlatSet<int> set = {10, 20, 30};
+  std::vector<int> batch = {25, 5, 20, 35, 5};
+  set.insert(batch.begin(), batch.end());
+  ExpectSame(set, {5, 10, 20, 25, 30, 35});
+  set.insert({0, 40});
+  EXPECT_EQ(*set.begin(), 0);
+  EXPECT_EQ(*(set.end() - 1), 40);
+}
+
+TEST(TestFlatSetModifiers, InsertRangeThrowingMoveKeepsTheSet) {
+  std::vector<Fragile> extra = {8, 2, 6, 4};
+  bool done = false;
+  for (int n = 0; !done; ++n) {
+    s21::FlatSet<Fragile> set = {1, 3, 5, 7, 9};
+    Fragile::countdown = n;
+    try {
+      set.insert(extra.begin(), extra.end());
+      done = true;
+    } catch (const std::runtime_error &) {
+    }
+    Fragile::countdown = -1;
+    std::vector<int> values;
+    for (const Fragile &key : set) values.push_back(key.value);
+    if (done) {
+      EXPECT_EQ(values, std::vector<int>({1, 2, 3, 4, 5, 6, 7, 8, 9}));
+    } else {
+      EXPECT_EQ(values, std::vector<int>({1, 3, 5, 7, 9}));
+    }
+  }
+}
+
+TEST(TestFlatSetModifiers, Erase) {
+  s21::FlatSet<int> set = {1, 2, 3};
+  set.erase(set.find(2));
+  set.erase(set.end());
+  EXPECT_EQ(set.erase(1), 1U);
+  EXPECT_EQ(set.erase(1), 0U);
+  ExpectSame(set, {3});
+}
+
+TEST(TestFlatSetModifiers, SwapAndMerge) {
+  s21::FlatSet<int> a = {1, 3, 5};
+  s21::FlatSet<int> b = {3, 4};
+  a.merge(b);
+  ExpectSame(a, {1, 3, 4, 5});
+  ExpectSame(b, {3});
+  a.swap(b);
+  ExpectSame(a, {3});
+  ExpectSame(b, {1, 3, 4, 5});
+}
+
+TEST(TestFlatSetLookup, MatchesStdSet) {
+  std::mt19937 gen(21);
+  s21::FlatSet<int> flat;
+  std::set<int> expected;
+  for (int step = 0; step < 3000; ++step) {
+    int key = gen() % 500;
+    switch (gen() % 3) {
+      case 0:
+        EXPECT_EQ(flat.insert(key).second, expected.insert(key).second);
+        break;
+      case 1:
+        EXPECT_EQ(flat.erase(key), expected.erase(key));
+        break;
+      default:
+        EXPECT_EQ(flat.contains(key), expected.count(key) == 1);
+    }
+  }
+  ExpectSame(flat, expected);
+}
@@ -2,19 +2,29 @@
 #define SRC_S21_LIST_H
 
 #include <cstddef>
+#include <functional>
 #include <initializer_list>
 #include <iostream>
 #include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "../NodePool/s21_node_pool.h"
 
 namespace s21 {
-template <typename T>
+// Nodes come from Allocator rebound to the node type. The default NodePool
+// recycles freed nodes and lets clear() return whole slabs at once.
+template <typename T, typename Allocator = NodePool<T>>
 class List {
  public:
   typedef struct Node_ {
     T data;
     Node_ *prev = nullptr;
     Node_ *next = nullptr;
-    explicit Node_(const T &data) : data(data), prev(nullptr), next(nullptr) {}
+    template <typename... Args>
+    explicit Node_(Args &&...args)
+        : data(std::forward<Args>(args)...), prev(nullptr), next(nullptr) {}
   } Node_;
 
   // Functions
@@ -33,9 +43,10 @@ class List {
   using value_type = T;
   using reference = T &;
   using const_reference = const T &;
-  using iterator = List<T>::ListIterator;
-  using const_iterator = List<T>::ListConstIterator;
+  using iterator = ListIterator;
+  using const_iterator = ListConstIterator;
   using size_type = size_t;
+  using allocator_type = Allocator;
 
   // Element access
   const_reference front() const;
@@ -52,20 +63,35 @@ class List {
   size_type size() const;
   size_type max_size() const noexcept;
 
+  allocator_type get_allocator() const { return allocator_type(alloc_); }
+
   // Modifiers
   void clear();
   iterator insert(iterator pos, const_reference value);
+  iterator insert(iterator pos, T &&value);
+  template <typename... Args>
+  iterator emplace(iterator pos, Args &&...args);
   void erase(iterator pos);
   void push_back(const_reference value);
+  void push_back(T &&value);
+  template <typename... Args>
+  reference emplace_back(Args &&...args);
   void pop_back();
   void push_front(const_reference value);
+  void push_front(T &&value);
+  template <typename... Args>
+  reference emplace_front(Args &&...args);
   void pop_front();
   void swap(List &other) noexcept;
   void merge(List &other);
+  template <typename Compare>
+  void merge(List &other, Compare comp);
   void splice(const_iterator pos, List &other);
   void reverse() noexcept;
   void unique();
   void sort();
+  template <typename Compare>
+  void sort(Compare comp);
 
   class ListIterator {
    public:
@@ -107,9 +133,22 @@ class List {
   };
 
  private:
+  using node_allocator = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<Node_>;
+  using node_traits = std::allocator_traits<node_allocator>;
+
   Node_ *head_;
   Node_ *tail_;
   size_t size_;
+  node_allocator alloc_;
+
+  template <typename... Args>
+  Node_ *CreateNode(Args &&...args);
+  void DestroyNode(Node_ *node);
+
+  template <typename Compare>
+  static Node_ *MergeRuns(Node_ *first, Node_ *second, Compare &comp);
+  void RelinkPrev();
 
 };  // class List
 
@@ -5,49 +5,60 @@
 namespace s21 {
 
 //______________________________________________________Functions
-template <typename T>
-List<T>::List() noexcept : head_(nullptr), tail_(nullptr), size_(0) {}
+template <typename T, typename Allocator>
+List<T, Allocator>::List() noexcept
+    : head_(nullptr), tail_(nullptr), size_(0) {}
 
-template <typename T>
-List<T>::~List() {
-  while (head_ != nullptr) pop_front();
+template <typename T, typename Allocator>
+List<T, Allocator>::~List() {
+  clear();
 }
 
-template <typename T>
-List<T>::List(size_t n) : head_(nullptr), tail_(nullptr), size_(0) {
+template <typename T, typename Allocator>
+List<T, Allocator>::List(size_t n)
+    : head_(nullptr), tail_(nullptr), size_(0) {
   for (size_type i = 0; i < n; i++) {
-    push_back(T());
+    emplace_back();
   }
 }
 
-template <typename T>
-List<T>::List(std::initializer_list<T> const &items)
+template <typename T, typename Allocator>
+List<T, Allocator>::List(std::initializer_list<T> const &items)
     : head_(nullptr), tail_(nullptr), size_(0) {
   for (const T &items : items) {
     push_back(items);
   }
 }
 
-template <typename T>
-List<T>::List(const List &l) : head_(nullptr), tail_(nullptr), size_(0) {
+template <typename T, typename Allocator>
+List<T, Allocator>::List(const List &l)
+    : head_(nullptr),
+      tail_(nullptr),
+      size_(0),
+      alloc_(node_traits::select_on_container_copy_construction(l.alloc_)) {
   for (const Node_ *current = l.head_; current != nullptr;
        current = current->next) {
     push_back(current->data);
   }
 }
 
-template <typename T>
-List<T>::List(List &&l) : head_(l.head_), tail_(l.tail_), size_(l.size_) {
+template <typename T, typename Allocator>
+List<T, Allocator>::List(List &&l)
+    : head_(l.head_),
+      tail_(l.tail_),
+      size_(l.size_),
+      alloc_(std::move(l.alloc_)) {
   l.head_ = nullptr;
   l.tail_ = nullptr;
   l.size_ = 0;
 }
 
-template <typename T>
-List<T> &List<T>::operator=(List &&l) {
+template <typename T, typename Allocator>
+List<T, Allocator> &List<T, Allocator>::operator=(List &&l) {
   if (this != &l) {
     clear();
 
+    alloc_ = std::move(l.alloc_);
     head_ = l.head_;
     tail_ = l.tail_;
     size_ = l.size_;
@@ -59,12 +70,10 @@ List<T> &List<T>::operator=(List &&l) {
   return *this;
 }
 
-template <typename T>
-List<T> &List<T>::operator=(const List &l) {
+template <typename T, typename Allocator>
+List<T, Allocator> &List<T, Allocator>::operator=(const List &l) {
   if (this != &l) {
-    while (!empty()) {
-      pop_front();
-    }
+    clear();
     Node_ *current = l.head_;
     while (current) {
       push_back(current->data);
@@ -74,18 +83,38 @@ List<T> &List<T>::operator=(const List &l) {
   return *this;
 }
 
+template <typename T, typename Allocator>
+template <typename... Args>
+typename List<T, Allocator>::Node_ *List<T, Allocator>::CreateNode(
+    Args &&...args) {
+  Node_ *node = node_traits::allocate(alloc_, 1);
+  try {
+    node_traits::construct(alloc_, node, std::forward<Args>(args)...);
+  } catch (...) {
+    node_traits::deallocate(alloc_, node, 1);
+    throw;
+  }
+  return node;
+}
+
+template <typename T, typename Allocator>
+void List<T, Allocator>::DestroyNode(Node_ *node) {
+  node_traits::destroy(alloc_, node);
+  node_traits::deallocate(alloc_, node, 1);
+}
+
 //________________________________________________________________Element access
 
-template <typename T>
-typename List<T>::const_reference List<T>::front() const {
+template <typename T, typename Allocator>
+typename List<T, Allocator>::const_reference List<T, Allocator>::front() const {
   if (head_ == nullptr) {
     throw std::out_of_range("List is empty");
   }
   return head_->data;
 }
 
-template <typename T>
-typename List<T>::const_reference List<T>::back() const {
+template <typename T, typename Allocator>
+typename List<T, Allocator>::const_reference List<T, Allocator>::back() const {
   if (head_ == nullptr) {
     throw std::out_of_range("List is empty");
   }
@@ -94,46 +123,48 @@ typename List<T>::const_reference List<T>::back() const {
 
 //_________________________________________________________________Iterators
 
-template <typename T>
-typename List<T>::iterator List<T>::begin() {
+template <typename T, typename Allocator>
+typename List<T, Allocator>::iterator List<T, Allocator>::begin() {
   return iterator(head_);
 }
 
-template <typename T>
-typename List<T>::const_iterator List<T>::c_begin() const {
+template <typename T, typename Allocator>
+typename List<T, Allocator>::const_iterator List<T, Allocator>::c_begin()
+    const {
   return const_iterator(head_);
 }
 
-template <typename T>
-typename List<T>::iterator List<T>::end() {
+template <typename T, typename Allocator>
+typename List<T, Allocator>::iterator List<T, Allocator>::end() {
   return iterator(tail_);
 }
 
-template <typename T>
-typename List<T>::const_iterator List<T>::c_end() const {
+template <typename T, typename Allocator>
+typename List<T, Allocator>::const_iterator List<T, Allocator>::c_end() const {
   return const_iterator(tail_);
 }
 
 //__________________________________________________________________Capacity
-template <typename T>
-bool List<T>::empty() const {
+template <typename T, typename Allocator>
+bool List<T, Allocator>::empty() const {
   return size_ == 0;
 }
 
-template <typename T>
-typename List<T>::size_type List<T>::size() const {
+template <typename T, typename Allocator>
+typename List<T, Allocator>::size_type List<T, Allocator>::size() const {
   return size_;
 }
 
-template <typename T>
-typename List<T>::size_type List<T>::max_size() const noexcept {
+template <typename T, typename Allocator>
+typename List<T, Allocator>::size_type List<T, Allocator>::max_size()
+    const noexcept {
   return std::numeric_limits<size_type>::max();
 }
 
 //________________________________________________________________________Modifiers
 
-template <typename T>
-void List<T>::pop_front() {
+template <typename T, typename Allocator>
+void List<T, Allocator>::pop_front() {
   if (head_ != nullptr) {
     Node_ *tmp_node = head_->next;
     if (tmp_node != nullptr) {
@@ -141,15 +172,27 @@ void List<T>::pop_front() {
     } else {
       tail_ = nullptr;
     }
-    delete head_;
+    DestroyNode(head_);
     head_ = tmp_node;
     size_--;
   }
 }
 
-template <typename T>
-void List<T>::push_back(const_reference value) {
-  Node_ *new_node = new Node_(value);
+template <typename T, typename Allocator>
+void List<T, Allocator>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+template <typename T, typename Allocator>
+void List<T, Allocator>::push_back(T &&value) {
+  emplace_back(std::move(value));
+}
+
+template <typename T, typename Allocator>
+template <typename... Args>
+typename List<T, Allocator>::reference List<T, Allocator>::emplace_back(
+    Args &&...args) {
+  Node_ *new_node = CreateNode(std::forward<Args>(args)...);
   if (head_ == nullptr) {
     head_ = tail_ = new_node;
   } else {
@@ -158,19 +201,49 @@ void List<T>::push_back(const_reference value) {
     tail_ = new_node;
   }
   size_++;
+  return new_node->data;
+}
+
+// With a node pool the values are destroyed (when they need it) and then
+// all slabs are handed back at once instead of freeing node by node; the
+// arenas adopted from merged or spliced lists are let go as well.
+template <typename T, typename Allocator>
+void List<T, Allocator>::clear() {
+  if constexpr (is_node_pool_v<node_allocator>) {
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+      for (Node_ *node = head_; node;) {
+        Node_ *next = node->next;
+        node_traits::destroy(alloc_, node);
+        node = next;
+      }
+    }
+    alloc_.release();
+    head_ = tail_ = nullptr;
+    size_ = 0;
+  } else {
+    while (head_ != nullptr && tail_ != nullptr) {
+      pop_front();
+    }
+  }
 }
 
-template <typename T>
-void List<T>::clear() {
-  while (head_ != nullptr && tail_ != nullptr) {
-    pop_front();
-  }
-};
+template <typename T, typename Allocator>
+typename List<T, Allocator>::iterator List<T, Allocator>::insert(
+    iterator pos, const_reference value) {
+  return emplace(pos, value);
+}
+
+template <typename T, typename Allocator>
+typename List<T, Allocator>::iterator List<T, Allocator>::insert(
+    iterator pos, T &&value) {
+  return emplace(pos, std::move(value));
+}
 
-template <typename T>
-typename List<T>::iterator List<T>::insert(iterator pos,
-                                           const_reference value) {
-  Node_ *newNode = new Node_(value);
+template <typename T, typename Allocator>
+template <typename... Args>
+typename List<T, Allocator>::iterator List<T, Allocator>::emplace(
+    iterator pos, Args &&...args) {
+  Node_ *newNode = CreateNode(std::forward<Args>(args)...);
   if (pos.get_node() == tail_) {
     if (empty()) {
       head_ = newNode;
@@ -199,8 +272,8 @@ typename List<T>::iterator List<T>::insert(iterator pos,
   return iterator(newNode);
 }
 
-template <typename T>
-void List<T>::erase(iterator pos) {
+template <typename T, typename Allocator>
+void List<T, Allocator>::erase(iterator pos) {
   Node_ *current = pos.get_node();
 
   if (current == nullptr) {
@@ -226,12 +299,12 @@ void List<T>::erase(iterator pos) {
     tail_ = nullptr;
   }
 
-  delete current;
+  DestroyNode(current);
   size_--;
 }
 
-template <typename T>
-void List<T>::pop_back() {
+template <typename T, typename Allocator>
+void List<T, Allocator>::pop_back() {
   if (head_ == nullptr) {
     throw std::out_of_range("List is empty");
   }
@@ -242,14 +315,26 @@ void List<T>::pop_back() {
   } else {
     head_ = tmp_node;
   }
-  delete tail_;
+  DestroyNode(tail_);
   tail_ = tmp_node;
   size_--;
 }
 
-template <typename T>
-void List<T>::push_front(const_reference value) {
-  Node_ *new_node = new Node_(value);
+template <typename T, typename Allocator>
+void List<T, Allocator>::push_front(const_reference value) {
+  emplace_front(value);
+}
+
+template <typename T, typename Allocator>
+void List<T, Allocator>::push_front(T &&value) {
+  emplace_front(std::move(value));
+}
+
+template <typename T, typename Allocator>
+template <typename... Args>
+typename List<T, Allocator>::reference List<T, Allocator>::emplace_front(
+    Args &&...args) {
+  Node_ *new_node = CreateNode(std::forward<Args>(args)...);
   if (head_ == nullptr) {
     head_ = tail_ = new_node;
   } else {
@@ -258,52 +343,137 @@ void List<T>::push_front(const_reference value) {
     head_ = new_node;
   }
   size_++;
+  return new_node->data;
+}
+
+template <typename T, typename Allocator>
+void List<T, Allocator>::merge(List &other) {
+  merge(other, std::less<>());
 }
 
-template <typename T>
-void List<T>::merge(List &other) {
-  List result;
-  iterator this_begin = begin();
-  iterator other_begin = other.begin();
-  if (other.empty()) {
+// Both lists must already be sorted by comp. The nodes of other are linked
+// into this list in one pass without allocating; on ties the element of
+// this list goes first. The walk stops as soon as either list runs out.
+template <typename T, typename Allocator>
+template <typename Compare>
+void List<T, Allocator>::merge(List &other, Compare comp) {
+  if (this == &other || other.empty()) {
     return;
   }
-  if (empty()) {
-    other.sort();
-    *this = std::move(other);
-    return;
+  if constexpr (is_node_pool_v<node_allocator>) {
+    alloc_.adopt(other.alloc_);
   }
-  while (this_begin != ++end()) {
-    result.push_back(*this_begin);
-    this_begin++;
+  Node_ *first = head_;
+  Node_ *second = other.head_;
+  Node_ *prev = nullptr;
+  Node_ **link = &head_;
+  while (first && second) {
+    Node_ *node;
+    if (comp(second->data, first->data)) {
+      node = second;
+      second = second->next;
+    } else {
+      node = first;
+      first = first->next;
+    }
+    *link = node;
+    node->prev = prev;
+    prev = node;
+    link = &node->next;
   }
-  while (other_begin != ++other.end()) {
-    result.push_back(*other_begin);
-    other_begin++;
+  if (first) {
+    *link = first;
+    first->prev = prev;
+  } else {
+    *link = second;
+    second->prev = prev;
+    tail_ = other.tail_;
   }
-  result.sort();
-  clear();
-  *this = std::move(result);
+  size_ += other.size_;
+  other.head_ = nullptr;
+  other.tail_ = nullptr;
+  other.size_ = 0;
 }
 
-template <typename T>
-void List<T>::sort() {
-  for (auto iter = begin(); iter != ++end(); ++iter) {
-    for (auto innerIter = begin(); innerIter != ++end(); ++innerIter) {
-      auto nextIter = innerIter;
-      ++nextIter;
+template <typename T, typename Allocator>
+void List<T, Allocator>::sort() {
+  sort(std::less<>());
+}
 
-      if (nextIter != ++end()) {
-        if (*innerIter > *nextIter) {
-          std::swap(*innerIter, *nextIter);
-        }
-      }
+// Bottom-up merge sort over the next pointers: runs[i] holds a sorted run
+// of 2^i nodes, and each new node is carried up through the occupied slots
+// like a binary counter. Runs in higher slots hold earlier nodes, so ties
+// keep their order. Only pointers change; the prev links are rebuilt at
+// the end.
+template <typename T, typename Allocator>
+template <typename Compare>
+void List<T, Allocator>::sort(Compare comp) {
+  if (size_ < 2) {
+    return;
+  }
+  Node_ *runs[std::numeric_limits<size_type>::digits] = {};
+  size_type used = 0;
+  Node_ *node = head_;
+  while (node) {
+    Node_ *run = node;
+    node = node->next;
+    run->next = nullptr;
+    size_type i = 0;
+    for (; runs[i]; ++i) {
+      run = MergeRuns(runs[i], run, comp);
+      runs[i] = nullptr;
+    }
+    runs[i] = run;
+    if (i >= used) {
+      used = i + 1;
     }
   }
+  Node_ *sorted = nullptr;
+  for (size_type i = 0; i < used; ++i) {
+    if (runs[i]) {
+      sorted = sorted ? MergeRuns(runs[i], sorted, comp) : runs[i];
+    }
+  }
+  head_ = sorted;
+  RelinkPrev();
+}
+
+// Merges two null-terminated chains; on ties the node from first goes
+// first.
+template <typename T, typename Allocator>
+template <typename Compare>
+typename List<T, Allocator>::Node_ *List<T, Allocator>::MergeRuns(
+    Node_ *first, Node_ *second, Compare &comp) {
+  Node_ *head = nullptr;
+  Node_ **link = &head;
+  while (first && second) {
+    if (comp(second->data, first->data)) {
+      *link = second;
+      second = second->next;
+    } else {
+      *link = first;
+      first = first->next;
+    }
+    link = &(*link)->next;
+  }
+  *link = first ? first : second;
+  return head;
+}
+
+// Restores the prev pointers and tail_ after the list was rebuilt through
+// the next pointers from head_.
+template <typename T, typename Allocator>
+void List<T, Allocator>::RelinkPrev() {
+  Node_ *prev = nullptr;
+  for (Node_ *node = head_; node; node = node->next) {
+    node->prev = prev;
+    prev = node;
+  }
+  tail_ = prev;
 }
 
-template <typename T>
-void List<T>::reverse() noexcept {
+template <typename T, typename Allocator>
+void List<T, Allocator>::reverse() noexcept {
   if (head_ == nullptr ||
       head_ == tail_) {  // Пустой список или один элемент - ничего не делаем
     return;
@@ -316,13 +486,17 @@ void List<T>::reverse() noexcept {
   std::swap(head_, tail_);
 }
 
-template <typename T>
-void List<T>::splice(const_iterator pos, List &other) {
+template <typename T, typename Allocator>
+void List<T, Allocator>::splice(const_iterator pos, List &other) {
+  if (other.head_ == nullptr) return;  // если список пуст, то ничего не делаем
   // находим наши узлы
-  Node_ *target_node = const_cast<s21::List<int>::Node_ *>(pos.get_node());
+  Node_ *target_node = const_cast<Node_ *>(pos.get_node());
   Node_ *first_node_other = other.head_;
   Node_ *last_node_other = other.tail_;
-  if (other.head_ == nullptr) return;  // если список пуст, то ничего не делаем
+  // every node of other moves, so its arena has to stay alive with ours
+  if constexpr (is_node_pool_v<node_allocator>) {
+    alloc_.adopt(other.alloc_);
+  }
   if (target_node != nullptr) {  // Обновляем указатели в начальном списке
     Node_ *prev_target_node = target_node->prev;
     if (prev_target_node != nullptr) {
@@ -351,15 +525,16 @@ void List<T>::splice(const_iterator pos, List &other) {
   other.tail_ = nullptr;
 }
 
-template <typename T>
-void List<T>::swap(List &other) noexcept {
+template <typename T, typename Allocator>
+void List<T, Allocator>::swap(List &other) noexcept {
   std::swap(head_, other.head_);
   std::swap(tail_, other.tail_);
   std::swap(size_, other.size_);
+  std::swap(alloc_, other.alloc_);
 }
 
-template <typename T>
-void List<T>::unique() {
+template <typename T, typename Allocator>
+void List<T, Allocator>::unique() {
   auto iter = begin();
   Node_ *current_node;
   Node_ *next_node;
@@ -377,125 +552,137 @@ void List<T>::unique() {
 }
 
 //_________________________________________________________class ListIterator
-template <typename T>
-List<T>::ListIterator::ListIterator() : iter_(nullptr) {}
+template <typename T, typename Allocator>
+List<T, Allocator>::ListIterator::ListIterator() : iter_(nullptr) {}
 
-template <typename T>
-List<T>::ListIterator::ListIterator(const ListIterator &other)
+template <typename T, typename Allocator>
+List<T, Allocator>::ListIterator::ListIterator(const ListIterator &other)
     : iter_(other.iter_) {}
 
-template <typename T>
-List<T>::ListIterator::ListIterator(Node_ *iter) : iter_(iter) {}
+template <typename T, typename Allocator>
+List<T, Allocator>::ListIterator::ListIterator(Node_ *iter) : iter_(iter) {}
 
-template <typename T>
-typename List<T>::ListIterator &List<T>::ListIterator::operator=(
-    const ListIterator &other) {
+template <typename T, typename Allocator>
+typename List<T, Allocator>::ListIterator &
+List<T, Allocator>::ListIterator::operator=(const ListIterator &other) {
   iter_ = other.iter_;
   return *this;
 }
 
-template <typename T>
-bool List<T>::ListIterator::operator==(const ListIterator &other) const {
+template <typename T, typename Allocator>
+bool List<T, Allocator>::ListIterator::operator==(
+    const ListIterator &other) const {
   return iter_ == other.iter_;
 }
 
-template <typename T>
-bool List<T>::ListIterator::operator!=(const ListIterator &other) const {
+template <typename T, typename Allocator>
+bool List<T, Allocator>::ListIterator::operator!=(
+    const ListIterator &other) const {
   return iter_ != other.iter_;
 }
 
-template <typename T>
-typename List<T>::ListIterator List<T>::ListIterator::operator++() {
+template <typename T, typename Allocator>
+typename List<T, Allocator>::ListIterator
+List<T, Allocator>::ListIterator::operator++() {
   iter_ = iter_->next;
   return *this;
 }
 
-template <typename T>
-typename List<T>::ListIterator List<T>::ListIterator::operator--() {
+template <typename T, typename Allocator>
+typename List<T, Allocator>::ListIterator
+List<T, Allocator>::ListIterator::operator--() {
   iter_ = iter_->prev;
   return *this;
 }
 
-template <typename T>
-typename List<T>::ListIterator List<T>::ListIterator::operator++(int) {
+template <typename T, typename Allocator>
+typename List<T, Allocator>::ListIterator
+List<T, Allocator>::ListIterator::operator++(int) {
   ListIterator tmp(*this);
   iter_ = iter_->next;
   return tmp;
 }
 
-template <typename T>
-T &List<T>::ListIterator::operator*() {
+template <typename T, typename Allocator>
+T &List<T, Allocator>::ListIterator::operator*() {
   return iter_->data;
 }
 
-template <typename T>
-T *List<T>::ListIterator::operator->() {
-  return &(iter_->value);
+template <typename T, typename Allocator>
+T *List<T, Allocator>::ListIterator::operator->() {
+  return &(iter_->data);
 }
 
-template <typename T>
-typename List<T>::Node_ *List<T>::ListIterator::get_node() {
+template <typename T, typename Allocator>
+typename List<T, Allocator>::Node_ *
+List<T, Allocator>::ListIterator::get_node() {
   return iter_;
 }
 
 //_________________________________________________class ListConstIterator
 
-template <typename T>
-List<T>::ListConstIterator::ListConstIterator() : iter_(nullptr) {}
+template <typename T, typename Allocator>
+List<T, Allocator>::ListConstIterator::ListConstIterator() : iter_(nullptr) {}
 
-template <typename T>
-List<T>::ListConstIterator::ListConstIterator(const ListConstIterator &other)
+template <typename T, typename Allocator>
+List<T, Allocator>::ListConstIterator::ListConstIterator(
+    const ListConstIterator &other)
     : iter_(other.iter_) {}
 
-template <typename T>
-List<T>::ListConstIterator::ListConstIterator(Node_ *iter_) : iter_(iter_) {}
+template <typename T, typename Allocator>
+List<T, Allocator>::ListConstIterator::ListConstIterator(Node_ *iter_)
+    : iter_(iter_) {}
 
-template <typename T>
-typename List<T>::ListConstIterator &List<T>::ListConstIterator::operator=(
+template <typename T, typename Allocator>
+typename List<T, Allocator>::ListConstIterator &
+List<T, Allocator>::ListConstIterator::operator=(
     const ListConstIterator &other) {
   iter_ = other.iter_;
   return *this;
 }
 
-template <typename T>
-bool List<T>::ListConstIterator::operator==(
+template <typename T, typename Allocator>
+bool List<T, Allocator>::ListConstIterator::operator==(
     const ListConstIterator &other) const {
   return iter_ == other.iter_;
 }
 
-template <typename T>
-bool List<T>::ListConstIterator::operator!=(
+template <typename T, typename Allocator>
+bool List<T, Allocator>::ListConstIterator::operator!=(
     const ListConstIterator &other) const {
   return iter_ != other.iter_;
 }
 
-template <typename T>
-typename List<T>::ListConstIterator List<T>::ListConstIterator::operator++() {
+template <typename T, typename Allocator>
+typename List<T, Allocator>::ListConstIterator
+List<T, Allocator>::ListConstIterator::operator++() {
   iter_ = iter_->next;
   return *this;
 }
 
-template <typename T>
-typename List<T>::ListConstIterator List<T>::ListConstIterator::operator--() {
+template <typename T, typename Allocator>
+typename List<T, Allocator>::ListConstIterator
+List<T, Allocator>::ListConstIterator::operator--() {
   iter_ = iter_->prev;
   return *this;
 }
 
-template <typename T>
-typename List<T>::ListConstIterator List<T>::ListConstIterator::operator++(
-    int) {
+template <typename T, typename Allocator>
+typename List<T, Allocator>::ListConstIterator
+List<T, Allocator>::ListConstIterator::operator++(int) {
   ListConstIterator tmp(*this);
   iter_ = iter_->next;
   return tmp;
 }
 
-template <typename T>
-const T &List<T>::ListConstIterator::operator*() const {
+template <typename T, typename Allocator>
+const T &List<T, Allocator>::ListConstIterator::operator*() const {
   return iter_->data;
 }
 
-template <typename T>
-const typename List<T>::Node_ *List<T>::ListConstIterator::get_node() const {
+template <typename T, typename Allocator>
+const typename List<T, Allocator>::Node_ *
+List<T, Allocator>::ListConstIterator::get_node() const {
   return iter_;
 }
 
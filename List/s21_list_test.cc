@@ -1,9 +1,17 @@
 #include "s21_list.h"
 
 #include <gtest/gtest.h>
+#include <malloc.h>
 
 #include <iostream>
+#include <algorithm>
+#include <functional>
 #include <list>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
 
 // Тестирование конструктора по умолчанию
 TEST(List, Constructor_Default) {
@@ -518,4 +526,253 @@ TEST(ListIterator, IteratorBegin) {
 
   auto it = myList.begin();
   EXPECT_EQ(*it, 1);
-}
\ No newline at end of file
+}
+TEST(ListEmplace, MoveOnlyElements) {
+  s21::List<std::unique_ptr<int>> s21_list;
+  s21_list.emplace_back(new int(2));
+  s21_list.emplace_front(new int(0));
+  s21_list.push_back(std::make_unique<int>(3));
+  auto it = s21_list.begin();
+  ++it;
+  s21_list.emplace(it, new int(1));
+  s21_list.insert(s21_list.begin(), std::make_unique<int>(-1));
+  ASSERT_EQ(s21_list.size(), 5u);
+  int expected = -1;
+  for (auto i = s21_list.begin(); i != ++s21_list.end(); ++i) {
+    EXPECT_EQ(**i, expected++);
+  }
+}
+
+TEST(ListEmplace, ConstructsInPlace) {
+  s21::List<std::string> s21_list;
+  std::string &back = s21_list.emplace_back(3, 'b');
+  std::string &front = s21_list.emplace_front(2, 'a');
+  EXPECT_EQ(back, "bbb");
+  EXPECT_EQ(front, "aa");
+  EXPECT_EQ(&front, &s21_list.front());
+  std::string value(50, 'c');
+  s21_list.push_back(std::move(value));
+  EXPECT_EQ(s21_list.back(), std::string(50, 'c'));
+  EXPECT_TRUE(value.empty());
+}
+
+TEST(ListSort, MatchesStdList) {
+  std::mt19937 gen(7);
+  s21::List<int> s21_list;
+  std::list<int> std_list;
+  for (int i = 0; i < 10000; ++i) {
+    int value = static_cast<int>(gen() % 1000);
+    s21_list.push_back(value);
+    std_list.push_back(value);
+  }
+  s21_list.sort();
+  std_list.sort();
+  ASSERT_EQ(s21_list.size(), std_list.size());
+  auto std_it = std_list.begin();
+  for (auto it = s21_list.begin(); it != ++s21_list.end(); ++it) {
+    ASSERT_EQ(*it, *std_it++);
+  }
+  // The prev links must be rebuilt as well.
+  auto back = s21_list.end();
+  for (auto it = std_list.rbegin(); it != std_list.rend(); ++it) {
+    ASSERT_EQ(*back, *it);
+    --back;
+  }
+}
+
+TEST(ListSort, IsStableWithComparator) {
+  s21::List<std::pair<int, int>> s21_list;
+  for (int i = 0; i < 1000; ++i) {
+    s21_list.emplace_back(i % 10, i);
+  }
+  s21_list.sort([](const std::pair<int, int> &a,
+                   const std::pair<int, int> &b) { return a.first > b.first; });
+  auto it = s21_list.begin();
+  auto prev = *it;
+  for (++it; it != ++s21_list.end(); ++it) {
+    ASSERT_GE(prev.first, (*it).first);
+    if (prev.first == (*it).first) {
+      ASSERT_LT(prev.second, (*it).second);
+    }
+    prev = *it;
+  }
+}
+
+TEST(ListSort, RelinksNodesWithoutMovingValues) {
+  s21::List<std::string> s21_list = {"pear", "apple", "fig", "kiwi"};
+  std::vector<const std::string *> before;
+  for (auto it = s21_list.begin(); it != ++s21_list.end(); ++it) {
+    before.push_back(&*it);
+  }
+  s21_list.sort();
+  std::vector<const std::string *> after;
+  for (auto it = s21_list.begin(); it != ++s21_list.end(); ++it) {
+    after.push_back(&*it);
+  }
+  EXPECT_EQ(s21_list.front(), "apple");
+  EXPECT_EQ(s21_list.back(), "pear");
+  std::sort(before.begin(), before.end());
+  std::sort(after.begin(), after.end());
+  EXPECT_EQ(before, after);
+}
+
+TEST(ListMerge, MatchesStdList) {
+  std::mt19937 gen(11);
+  s21::List<int> first, second;
+  std::list<int> std_first, std_second;
+  for (int i = 0; i < 5000; ++i) {
+    int value = static_cast<int>(gen() % 100);
+    if (gen() % 3) {
+      first.push_back(value);
+      std_first.push_back(value);
+    } else {
+      second.push_back(value);
+      std_second.push_back(value);
+    }
+  }
+  first.sort();
+  second.sort();
+  std_first.sort();
+  std_second.sort();
+  first.merge(second);
+  std_first.merge(std_second);
+  EXPECT_TRUE(second.empty());
+  EXPECT_THROW(second.back(), std::out_of_range);
+  ASSERT_EQ(first.size(), std_first.size());
+  auto std_it = std_first.begin();
+  for (auto it = first.begin(); it != ++first.end(); ++it) {
+    ASSERT_EQ(*it, *std_it++);
+  }
+  auto back = first.end();
+  for (auto it = std_first.rbegin(); it != std_first.rend(); ++it) {
+    ASSERT_EQ(*back, *it);
+    --back;
+  }
+}
+
+TEST(ListMerge, IsStableWithComparator) {
+  using Item = std::pair<int, char>;
+  auto greater = [](const Item &a, const Item &b) { return a.first > b.first; };
+  s21::List<Item> first = {{5, 'a'}, {3, 'a'}, {3, 'a'}, {1, 'a'}};
+  s21::List<Item> second = {{6, 'b'}, {3, 'b'}, {0, 'b'}};
+  const Item *moved = &second.front();
+  first.merge(second, greater);
+  std::vector<Item> expected = {{6, 'b'}, {5, 'a'}, {3, 'a'}, {3, 'a'},
+                                {3, 'b'}, {1, 'a'}, {0, 'b'}};
+  std::vector<Item> merged;
+  for (auto it = first.begin(); it != ++first.end(); ++it) {
+    merged.push_back(*it);
+  }
+  EXPECT_EQ(merged, expected);
+  EXPECT_EQ(&first.front(), moved);
+  EXPECT_EQ(first.back(), Item(0, 'b'));
+}
+
+TEST(ListMerge, MergeWithItselfIsNoop) {
+  s21::List<int> list = {1, 2, 3};
+  list.merge(list);
+  EXPECT_EQ(list.size(), 3u);
+  EXPECT_EQ(list.back(), 3);
+}
+
+TEST(ListAllocator, StdAllocator) {
+  s21::List<std::string, std::allocator<std::string>> s21_list = {"b", "a"};
+  s21_list.push_front("c");
+  s21_list.sort();
+  EXPECT_EQ(s21_list.front(), "a");
+  EXPECT_EQ(s21_list.back(), "c");
+  s21_list.clear();
+  EXPECT_TRUE(s21_list.empty());
+}
+
+TEST(ListAllocator, ClearReleasesAndReuses) {
+  s21::List<std::string> s21_list;
+  for (int i = 0; i < 10000; ++i) {
+    s21_list.push_back(std::string(32, 'x'));
+  }
+  s21_list.clear();
+  EXPECT_TRUE(s21_list.empty());
+  s21_list.push_back("again");
+  EXPECT_EQ(s21_list.size(), 1u);
+  EXPECT_EQ(s21_list.front(), "again");
+}
+
+TEST(ListAllocator, NodesOutliveDonorList) {
+  s21::List<std::string> s21_list = {"a", "d"};
+  {
+    s21::List<std::string> sorted = {"b", "c", "e"};
+    s21_list.merge(sorted);
+    s21::List<std::string> spliced = {"0"};
+    s21_list.splice(s21_list.c_begin(), spliced);
+  }
+  std::vector<std::string> expected = {"0", "a", "b", "c", "d", "e"};
+  std::vector<std::string> values;
+  for (auto it = s21_list.begin(); it != ++s21_list.end(); ++it) {
+    values.push_back(*it);
+  }
+  EXPECT_EQ(values, expected);
+  s21_list.pop_front();
+  s21_list.push_back("f");
+  EXPECT_EQ(s21_list.back(), "f");
+}
+
+// Bytes currently handed out by malloc, including mmap-ed chunks.
+static size_t HeapBytes() {
+  struct mallinfo2 info = mallinfo2();
+  return info.uordblks + info.hblkhd;
+}
+
+TEST(ListAllocator, ClearDropsSplicedArenas) {
+  s21::List<int> s21_list;
+  size_t before = 0;
+  for (int round = 0; round < 200; ++round) {
+    if (round == 10) before = HeapBytes();
+    s21::List<int> shard;
+    for (int i = 0; i < 1000; ++i) shard.push_back(i);
+    if (round % 2) {
+      s21_list.splice(s21_list.c_end(), shard);
+    } else {
+      s21_list.merge(shard);
+    }
+    EXPECT_EQ(s21_list.size(), 1000u);
+    s21_list.clear();
+  }
+  // one retained shard alone would be well over 16 KiB
+  EXPECT_LT(HeapBytes(), before + 4096);
+}
+
+TEST(ListAllocator, SpliceKeepsTheArenasTheDonorAdopted) {
+  s21::List<int> s21_list = {3};
+  {
+    s21::List<int> middle = {2};
+    {
+      s21::List<int> first = {1};
+      middle.splice(middle.c_begin(), first);
+    }
+    s21_list.splice(s21_list.c_begin(), middle);
+    // drops what middle adopted, s21_list still needs it
+    middle.clear();
+  }
+  for (int round = 0; round < 3; ++round) {
+    s21::List<int> again = {4};
+    s21_list.merge(again);
+  }
+  std::vector<int> expected = {1, 2, 3, 4, 4, 4};
+  std::vector<int> values;
+  for (auto it = s21_list.begin(); it != ++s21_list.end(); ++it) {
+    values.push_back(*it);
+  }
+  EXPECT_EQ(values, expected);
+}
+
+TEST(ListAllocator, CopyAndMoveKeepSeparatePools) {
+  s21::List<int> original = {1, 2, 3};
+  s21::List<int> copy(original);
+  s21::List<int> moved(std::move(original));
+  moved.push_back(4);
+  original.push_back(5);
+  EXPECT_EQ(moved.size(), 4u);
+  EXPECT_EQ(original.size(), 1u);
+  copy = moved;
+  EXPECT_EQ(copy.back(), 4);
+}
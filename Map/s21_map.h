@@ -8,9 +8,12 @@
 
 namespace s21 {
 
-template <typename Key, typename T>
-class Map : public RedBlackTree<Key, T> {
+template <typename Key, typename T, typename Compare = std::less<Key>,
+          typename Allocator = NodePool<std::pair<const Key, T>>>
+class Map : public RedBlackTree<Key, T, Compare, Allocator> {
  public:
+  using Base = RedBlackTree<Key, T, Compare, Allocator>;
+
   // Member type
   using key_type = Key;
   using mapped_type = T;
@@ -18,23 +21,32 @@ class Map : public RedBlackTree<Key, T> {
   using reference = value_type&;
   using const_reference = const value_type&;
 
-  using iterator = typename RedBlackTree<Key, T>::iterator;
-  using const_iterator = typename RedBlackTree<Key, T>::const_iterator;
+  using iterator = typename Base::iterator;
+  using const_iterator = typename Base::const_iterator;
 
   using size_type = size_t;
+  using key_compare = Compare;
+  using allocator_type = Allocator;
 
   // Functions
-  Map() : RedBlackTree<Key, T>(){};
+  Map() : Base(){};
+  explicit Map(const Compare& comp) : Base(comp) {}
   Map(std::initializer_list<value_type> const& items);
-  Map(const Map& other) : RedBlackTree<Key, T>(other){};
-  Map(Map&& other) noexcept : RedBlackTree<Key, T>(std::move(other)){};
+  Map(const Map& other) : Base(other){};
+  Map(Map&& other) noexcept : Base(std::move(other)){};
   ~Map();
+
+  // Builds the map from pairs sorted by key in O(n).
+  template <typename InputIt>
+  static Map from_sorted(InputIt first, InputIt last);
+
   Map& operator=(Map&& other) noexcept;
   Map& operator=(const Map& other);
 
   // Element access
   T& at(const Key& key);
   T& operator[](const Key& key);
+  T& operator[](Key&& key);
 
   // Iterators
   iterator begin();
@@ -43,24 +55,34 @@ class Map : public RedBlackTree<Key, T> {
   const_iterator cend() const;
 
   // Capacity
-  bool empty() const { return RedBlackTree<Key, T>::empty(); };
-  size_type size() const { return RedBlackTree<Key, T>::size(); };
-  size_type max_size() { return RedBlackTree<Key, T>::max_size(); };
+  bool empty() const { return Base::empty(); };
+  size_type size() const { return Base::size(); };
+  size_type max_size() { return Base::max_size(); };
 
   // Modifiers
   void clear();
   std::pair<iterator, bool> insert(const value_type& value);
+  std::pair<iterator, bool> insert(value_type&& value);
   std::pair<iterator, bool> insert(const Key& key, const T& obj);
+  iterator insert(iterator hint, const value_type& value);
   std::pair<iterator, bool> insert_or_assign(const Key& key, const T& obj);
+  // emplace() and try_emplace() come from the base; try_emplace() builds the
+  // mapped value in the node only when the key is new.
+  using Base::emplace;
+  using Base::try_emplace;
   void erase(iterator pos);
+  using Base::erase;
   void swap(Map& other);
   void merge(Map& other);
 
   // Lookup
-  bool contains(const Key& key) { return RedBlackTree<Key, T>::contains(key); }
-
- private:
-  iterator find(const Key& key);
+  // With a transparent Compare such as std::less<> the base overloads also
+  // take any key type it can compare with Key, e.g. a std::string_view.
+  using Base::contains;
+  using Base::count;
+  using Base::find;
+  using Base::lower_bound;
+  using Base::upper_bound;
 
 };  // class map
 }  // namespace s21
@@ -6,118 +6,155 @@
 
 namespace s21 {
 
-template <typename Key, typename T>
-Map<Key, T>::Map(std::initializer_list<value_type> const &items)
-    : RedBlackTree<Key, T>() {
+template <typename Key, typename T, typename Compare, typename Allocator>
+Map<Key, T, Compare, Allocator>::Map(
+    std::initializer_list<value_type> const &items)
+    : Base() {
   for (auto i = items.begin(); i != items.end(); ++i) {
     this->insert(*i);
   }
 }
 
-template <typename Key, typename T>
-Map<Key, T>::~Map() {
-  RedBlackTree<Key, T>::clear();
+template <typename Key, typename T, typename Compare, typename Allocator>
+Map<Key, T, Compare, Allocator>::~Map() {
+  Base::clear();
 }
 
-template <typename Key, typename T>
-Map<Key, T> &Map<Key, T>::operator=(Map &&other) noexcept {
+template <typename Key, typename T, typename Compare, typename Allocator>
+template <typename InputIt>
+Map<Key, T, Compare, Allocator> Map<Key, T, Compare, Allocator>::from_sorted(
+    InputIt first, InputIt last) {
+  Map res;
+  res.assign_sorted(first, last);
+  return res;
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+Map<Key, T, Compare, Allocator> &Map<Key, T, Compare, Allocator>::operator=(
+    Map &&other) noexcept {
   if (this != &other) {
-    RedBlackTree<Key, T>::operator=(std::move(other));
+    Base::operator=(std::move(other));
   }
   return *this;
 }
 
-template <typename Key, typename T>
-Map<Key, T> &Map<Key, T>::operator=(const Map &other) {
+template <typename Key, typename T, typename Compare, typename Allocator>
+Map<Key, T, Compare, Allocator> &Map<Key, T, Compare, Allocator>::operator=(
+    const Map &other) {
   if (this != &other) {
-    RedBlackTree<Key, T>::operator=(other);
+    Base::operator=(other);
   }
   return *this;
 }
 
-template <typename Key, typename T>
-typename Map<Key, T>::iterator Map<Key, T>::begin() {
-  return iterator(RedBlackTree<Key, T>::begin().node());
+template <typename Key, typename T, typename Compare, typename Allocator>
+typename Map<Key, T, Compare, Allocator>::iterator
+Map<Key, T, Compare, Allocator>::begin() {
+  return Base::begin();
 }
 
-template <typename Key, typename T>
-typename Map<Key, T>::iterator Map<Key, T>::end() {
-  return iterator(RedBlackTree<Key, T>::end().node());
+template <typename Key, typename T, typename Compare, typename Allocator>
+typename Map<Key, T, Compare, Allocator>::iterator
+Map<Key, T, Compare, Allocator>::end() {
+  return Base::end();
 }
 
-template <typename Key, typename T>
-typename Map<Key, T>::const_iterator Map<Key, T>::cbegin() const {
-  return const_iterator(RedBlackTree<Key, T>::cbegin().node());
+template <typename Key, typename T, typename Compare, typename Allocator>
+typename Map<Key, T, Compare, Allocator>::const_iterator
+Map<Key, T, Compare, Allocator>::cbegin() const {
+  return Base::cbegin();
 }
 
-template <typename Key, typename T>
-typename Map<Key, T>::const_iterator Map<Key, T>::cend() const {
-  return const_iterator(RedBlackTree<Key, T>::cend().node());
+template <typename Key, typename T, typename Compare, typename Allocator>
+typename Map<Key, T, Compare, Allocator>::const_iterator
+Map<Key, T, Compare, Allocator>::cend() const {
+  return Base::cend();
 }
 
-template <typename Key, typename T>
-typename Map<Key, T>::iterator Map<Key, T>::find(const Key &key) {
-  return iterator(RedBlackTree<Key, T>::find(key).node());
-}
-
-template <typename Key, typename T>
-T &Map<Key, T>::at(const Key &key) {
-  iterator it = find(key);
+template <typename Key, typename T, typename Compare, typename Allocator>
+T &Map<Key, T, Compare, Allocator>::at(const Key &key) {
+  iterator it = Base::find(key);
   if (it != end()) {
-    return it.node()->value_;
+    return it.node()->value();
   } else {
     throw std::out_of_range("Key not found in the map");
   }
 }
 
-template <typename Key, typename T>
-T &Map<Key, T>::operator[](const Key &key) {
-  auto it = find(key);
-  if (it != end()) {
-    return it.node()->value_;
-  } else {
-    auto result = insert({key, T()});
-    return result.first.node()->value_;
+template <typename Key, typename T, typename Compare, typename Allocator>
+T &Map<Key, T, Compare, Allocator>::operator[](const Key &key) {
+  return Base::try_emplace(key).first.node()->value();
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+T &Map<Key, T, Compare, Allocator>::operator[](Key &&key) {
+  return Base::try_emplace(std::move(key)).first.node()->value();
+}
+
+// The key and the mapped value go to try_emplace() as they are, so a key
+// that is already there costs no copy of the mapped value.
+template <typename Key, typename T, typename Compare, typename Allocator>
+std::pair<typename Map<Key, T, Compare, Allocator>::iterator, bool>
+Map<Key, T, Compare, Allocator>::insert(const value_type &value) {
+  return insert(value.first, value.second);
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+std::pair<typename Map<Key, T, Compare, Allocator>::iterator, bool>
+Map<Key, T, Compare, Allocator>::insert(value_type &&value) {
+  auto result = Base::try_emplace(value.first, std::move(value.second));
+  if (!result.second) {
+    result.first = end();
   }
+  return result;
 }
 
-template <typename Key, typename T>
-std::pair<typename Map<Key, T>::iterator, bool> Map<Key, T>::insert(
-    const value_type &value) {
-  return RedBlackTree<Key, T>::insert(value);
+template <typename Key, typename T, typename Compare, typename Allocator>
+std::pair<typename Map<Key, T, Compare, Allocator>::iterator, bool>
+Map<Key, T, Compare, Allocator>::insert(const Key &key, const T &obj) {
+  auto result = Base::try_emplace(key, obj);
+  if (!result.second) {
+    result.first = end();
+  }
+  return result;
 }
 
-template <typename Key, typename T>
-std::pair<typename Map<Key, T>::iterator, bool> Map<Key, T>::insert(
-    const Key &key, const T &obj) {
-  return RedBlackTree<Key, T>::insert({key, obj});
+template <typename Key, typename T, typename Compare, typename Allocator>
+typename Map<Key, T, Compare, Allocator>::iterator
+Map<Key, T, Compare, Allocator>::insert(iterator hint,
+                                        const value_type &value) {
+  return Base::try_emplace(hint, value.first, value.second);
 }
 
-template <typename Key, typename T>
-std::pair<typename Map<Key, T>::iterator, bool> Map<Key, T>::insert_or_assign(
-    const Key &key, const T &obj) {
-  iterator it = find(key);
-  if (it != end()) {
-    it.node()->value_ = obj;
-    return {it, false};
-  } else {
-    return insert({key, obj});
+template <typename Key, typename T, typename Compare, typename Allocator>
+std::pair<typename Map<Key, T, Compare, Allocator>::iterator, bool>
+Map<Key, T, Compare, Allocator>::insert_or_assign(const Key &key,
+                                                  const T &obj) {
+  auto result = Base::try_emplace(key, obj);
+  if (!result.second) {
+    result.first.node()->value() = obj;
   }
+  return result;
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+void Map<Key, T, Compare, Allocator>::clear() {
+  Base::clear();
 }
 
-template <typename Key, typename T>
-void Map<Key, T>::erase(iterator pos) {
-  RedBlackTree<Key, T>::erase(pos);
+template <typename Key, typename T, typename Compare, typename Allocator>
+void Map<Key, T, Compare, Allocator>::erase(iterator pos) {
+  Base::erase(pos);
 }
 
-template <typename Key, typename T>
-void Map<Key, T>::swap(Map &other) {
-  RedBlackTree<Key, T>::swap(other);
+template <typename Key, typename T, typename Compare, typename Allocator>
+void Map<Key, T, Compare, Allocator>::swap(Map &other) {
+  Base::swap(other);
 }
 
-template <typename Key, typename T>
-void Map<Key, T>::merge(Map &other) {
-  RedBlackTree<Key, T>::merge(other);
+template <typename Key, typename T, typename Compare, typename Allocator>
+void Map<Key, T, Compare, Allocator>::merge(Map &other) {
+  Base::merge(other);
 }
 
 };  // namespace s21
@@ -4,7 +4,9 @@
 
 #include <iostream>
 #include <map>
+#include <memory>
 #include <string>
+#include <string_view>
 
 TEST(TestMapMapConstructor, DefaultConstructor) {
   s21::Map<int, int> m;
@@ -280,3 +282,158 @@ TEST(MapInsertTest, InsertKeyValue) {
 
   EXPECT_EQ(myMap.at(2), "two");
 }
+
+TEST(MapInsertTest, HintedInsert) {
+  s21::Map<int, std::string> myMap;
+  for (int i = 0; i < 10; ++i) {
+    myMap.insert(myMap.end(), {i, std::to_string(i)});
+  }
+  auto it = myMap.insert(myMap.begin(), {5, "duplicate"});
+  EXPECT_EQ(it.node()->value_, "5");
+  EXPECT_EQ(myMap.size(), 10u);
+  EXPECT_EQ(myMap.at(9), "9");
+}
+
+TEST(MapInsertTest, SubscriptInsertsOnce) {
+  s21::Map<int, int> myMap;
+  myMap[1] += 1;
+  myMap[1] += 1;
+  EXPECT_EQ(myMap.size(), 1u);
+  EXPECT_EQ(myMap.at(1), 2);
+  auto result = myMap.insert_or_assign(1, 7);
+  EXPECT_FALSE(result.second);
+  EXPECT_EQ(myMap.at(1), 7);
+}
+
+TEST(MapInsertTest, FromSorted) {
+  std::map<int, std::string> stdMap;
+  for (int i = 0; i < 1000; ++i) {
+    stdMap[i * 3] = std::to_string(i);
+  }
+  auto myMap = s21::Map<int, std::string>::from_sorted(stdMap.begin(),
+                                                        stdMap.end());
+  EXPECT_EQ(myMap.size(), stdMap.size());
+  EXPECT_EQ(myMap.at(300), "100");
+  myMap.insert(1, "new");
+  EXPECT_EQ(myMap.size(), stdMap.size() + 1);
+}
+
+TEST(TestMapEmplace, TryEmplaceMoveOnly) {
+  s21::Map<int, std::unique_ptr<std::string>> m;
+  auto value = std::make_unique<std::string>("one");
+  auto res = m.try_emplace(1, std::move(value));
+  ASSERT_TRUE(res.second);
+  ASSERT_EQ(*res.first.node()->value_, "one");
+  ASSERT_EQ(value, nullptr);
+
+  // The key is taken, so the argument must be left untouched.
+  auto other = std::make_unique<std::string>("uno");
+  res = m.try_emplace(1, std::move(other));
+  ASSERT_FALSE(res.second);
+  ASSERT_NE(other, nullptr);
+  ASSERT_EQ(*m.at(1), "one");
+}
+
+TEST(TestMapEmplace, InsertRvalue) {
+  s21::Map<std::string, std::unique_ptr<int>> m;
+  ASSERT_TRUE(m.insert({"a", std::make_unique<int>(1)}).second);
+  ASSERT_TRUE(m.emplace("b", std::make_unique<int>(2)).second);
+  ASSERT_FALSE(m.insert({"a", std::make_unique<int>(3)}).second);
+  m[std::string("c")] = std::make_unique<int>(3);
+  ASSERT_EQ(m.size(), 3u);
+  ASSERT_EQ(*m.at("a"), 1);
+  ASSERT_EQ(*m.at("b"), 2);
+  ASSERT_EQ(*m.at("c"), 3);
+}
+
+TEST(TestMapEmplace, TryEmplaceConstructsInPlace) {
+  s21::Map<int, std::string> m;
+  auto res = m.try_emplace(7, 3, 'z');
+  ASSERT_TRUE(res.second);
+  ASSERT_EQ(m.at(7), "zzz");
+}
+
+// Counts the copies and moves made of it.
+struct CountedValue {
+  static int copies;
+  static int moves;
+
+  explicit CountedValue(int value = 0) : value(value) {}
+  CountedValue(const CountedValue &other) : value(other.value) { ++copies; }
+  CountedValue(CountedValue &&other) noexcept : value(other.value) {
+    ++moves;
+  }
+  CountedValue &operator=(const CountedValue &other) {
+    value = other.value;
+    ++copies;
+    return *this;
+  }
+  CountedValue &operator=(CountedValue &&other) noexcept {
+    value = other.value;
+    ++moves;
+    return *this;
+  }
+
+  int value;
+};
+
+int CountedValue::copies = 0;
+int CountedValue::moves = 0;
+
+TEST(TestMapEmplace, DuplicateInsertCopiesNothing) {
+  s21::Map<int, CountedValue> m;
+  m.try_emplace(1, 10);
+  std::pair<const int, CountedValue> value(1, CountedValue(20));
+  std::pair<const int, CountedValue> temporary(1, CountedValue(21));
+  CountedValue obj(30);
+  CountedValue::copies = CountedValue::moves = 0;
+
+  EXPECT_FALSE(m.insert(value).second);
+  EXPECT_EQ(m.insert(value).first, m.end());
+  EXPECT_FALSE(m.insert(1, obj).second);
+  EXPECT_FALSE(m.insert(std::move(temporary)).second);
+  EXPECT_EQ(m.insert(m.begin(), value), m.begin());
+  EXPECT_EQ(m.insert(m.end(), value), m.begin());
+  EXPECT_EQ(CountedValue::copies, 0);
+  EXPECT_EQ(CountedValue::moves, 0);
+  EXPECT_EQ(m.at(1).value, 10);
+  EXPECT_EQ(temporary.second.value, 21);
+
+  EXPECT_TRUE(m.insert(2, obj).second);
+  EXPECT_EQ(CountedValue::copies, 1);
+  EXPECT_EQ(m.at(2).value, 30);
+}
+
+TEST(TestMapLookup, HeterogeneousKeys) {
+  s21::Map<std::string, int, std::less<>> m = {
+      {"apple", 1}, {"fig", 2}, {"pear", 3}};
+  std::string_view view = "fig";
+  auto it = m.find(view);
+  ASSERT_NE(it, m.end());
+  ASSERT_EQ(it.node()->value_, 2);
+  ASSERT_EQ(m.find(std::string_view("plum")), m.end());
+  ASSERT_TRUE(m.contains("pear"));
+  ASSERT_FALSE(m.contains(std::string_view("kiwi")));
+  ASSERT_EQ(m.count(view), 1u);
+  ASSERT_EQ(*m.lower_bound(std::string_view("b")), "fig");
+  ASSERT_EQ(*m.upper_bound(view), "pear");
+  ASSERT_EQ(m.upper_bound("pear"), m.end());
+  ASSERT_EQ(m.erase(view), 1u);
+  ASSERT_EQ(m.erase(view), 0u);
+  ASSERT_EQ(m.size(), 2u);
+  const auto& cm = m;
+  ASSERT_EQ(*cm.find(std::string_view("apple")), "apple");
+}
+
+TEST(TestMapLookup, CustomComparator) {
+  s21::Map<std::string, int, std::greater<std::string>> m = {
+      {"a", 1}, {"c", 3}, {"b", 2}};
+  std::string keys;
+  for (auto it = m.begin(); it != m.end(); ++it) {
+    keys += *it;
+  }
+  ASSERT_EQ(keys, "cba");
+  ASSERT_EQ(m.at("b"), 2);
+  m["d"] = 4;
+  ASSERT_EQ(*m.begin(), "d");
+}
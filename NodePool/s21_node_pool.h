@@ -0,0 +1,226 @@
+#ifndef S21_NODE_POOL_H
+#define S21_NODE_POOL_H
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace s21 {
+
+// Allocator for node based containers. Nodes are carved out of slabs that
+// grow geometrically up to SlabSize nodes, freed nodes go to a free list and
+// are handed out again, and all slabs are returned at once by release().
+//
+// Every container owns its own arena: copies of a container start with a
+// fresh pool, a moved-to container takes the arena over and the moved-from
+// one gets a new arena on its next allocation. When nodes move from one
+// container to another (merge, splice) the receiver adopt()s the donor's
+// arena, which keeps the donor's slabs alive as long as either side needs
+// them. A pool is not thread safe, just like the container owning it.
+template <typename T, size_t SlabSize = 4096>
+class NodePool {
+  static_assert(SlabSize >= 8, "Slabs must hold at least 8 nodes");
+
+ public:
+  using value_type = T;
+  using pointer = T *;
+  using size_type = size_t;
+  using difference_type = std::ptrdiff_t;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+  using is_always_equal = std::false_type;
+
+  template <typename U>
+  struct rebind {
+    using other = NodePool<U, SlabSize>;
+  };
+
+  NodePool() noexcept = default;
+
+  // A copy shares the arena, as allocator copies have to be able to free
+  // each other's memory.
+  NodePool(const NodePool &other) noexcept = default;
+  NodePool &operator=(const NodePool &other) noexcept = default;
+
+  NodePool(NodePool &&other) noexcept : arena_(std::move(other.arena_)) {}
+
+  NodePool &operator=(NodePool &&other) noexcept {
+    arena_ = std::move(other.arena_);
+    return *this;
+  }
+
+  // Pools of other types cannot share blocks of a different size.
+  template <typename U>
+  NodePool(const NodePool<U, SlabSize> &) noexcept {}
+
+  NodePool select_on_container_copy_construction() const noexcept {
+    return NodePool();
+  }
+
+  pointer allocate(size_type n) {
+    if (n != 1) {
+      return std::allocator<T>().allocate(n);
+    }
+    return reinterpret_cast<pointer>(Arena().Allocate());
+  }
+
+  void deallocate(pointer p, size_type n) noexcept {
+    if (n != 1) {
+      std::allocator<T>().deallocate(p, n);
+    } else {
+      arena_->Deallocate(reinterpret_cast<Block *>(p));
+    }
+  }
+
+  // Makes sure the next count single-node allocations do not need a new
+  // slab.
+  void reserve(size_type count) { Arena().Reserve(count); }
+
+  // Returns every slab at once. Nodes allocated from this pool must not be
+  // used afterwards; their destructors have to be run before, if needed.
+  void release() noexcept {
+    if (arena_) {
+      arena_->DropAdopted();
+      arena_.reset();
+    }
+  }
+
+  // Keeps the slabs of other alive for as long as this pool lives, so nodes
+  // allocated by other can be moved into a container using this pool and be
+  // deallocated through it.
+  void adopt(const NodePool &other) {
+    if (other.arena_ && other.arena_ != arena_) {
+      Arena().Adopt(other.arena_);
+    }
+  }
+
+  bool operator==(const NodePool &other) const noexcept {
+    return arena_ == other.arena_;
+  }
+
+  bool operator!=(const NodePool &other) const noexcept {
+    return !(*this == other);
+  }
+
+ private:
+  union Block {
+    Block *next;
+    alignas(T) unsigned char storage[sizeof(T)];
+  };
+
+  class SlabArena {
+   public:
+    SlabArena() = default;
+    SlabArena(const SlabArena &) = delete;
+    SlabArena &operator=(const SlabArena &) = delete;
+
+    ~SlabArena() {
+      for (const auto &slab : slabs_) {
+        std::allocator<Block>().deallocate(slab.first, slab.second);
+      }
+    }
+
+    Block *Allocate() {
+      Block *res = free_list_;
+      if (res) {
+        free_list_ = res->next;
+      } else {
+        if (cursor_ == end_) {
+          AddSlab(NextSlabSize());
+        }
+        res = cursor_++;
+      }
+      return res;
+    }
+
+    void Deallocate(Block *block) noexcept {
+      block->next = free_list_;
+      free_list_ = block;
+    }
+
+    void Reserve(size_type count) {
+      size_type available = static_cast<size_type>(end_ - cursor_);
+      for (Block *it = free_list_; it && available < count; it = it->next) {
+        ++available;
+      }
+      if (available < count) {
+        // the rest of the current slab goes to the free list first
+        while (cursor_ != end_) {
+          Deallocate(cursor_++);
+        }
+        AddSlab(count - available);
+      }
+    }
+
+    // The arenas other adopted are taken over as well: the nodes moving in
+    // may come from them, and other may drop them on its next release().
+    void Adopt(const std::shared_ptr<SlabArena> &other) {
+      AdoptOne(other);
+      for (const auto &arena : other->adopted_) {
+        AdoptOne(arena);
+      }
+    }
+
+    void DropAdopted() noexcept { adopted_.clear(); }
+
+   private:
+    // Merging from the same donor again and again must not pile up entries.
+    void AdoptOne(const std::shared_ptr<SlabArena> &arena) {
+      if (arena.get() != this &&
+          std::find(adopted_.begin(), adopted_.end(), arena) ==
+              adopted_.end()) {
+        adopted_.push_back(arena);
+      }
+    }
+
+    size_type NextSlabSize() const {
+      size_type last = slabs_.empty() ? 4 : slabs_.back().second;
+      return last * 2 < SlabSize ? last * 2 : SlabSize;
+    }
+
+    void AddSlab(size_type count) {
+      slabs_.reserve(slabs_.size() + 1);
+      Block *slab = std::allocator<Block>().allocate(count);
+      slabs_.emplace_back(slab, count);
+      cursor_ = slab;
+      end_ = slab + count;
+    }
+
+    Block *free_list_ = nullptr;
+    Block *cursor_ = nullptr;  // unused part of the newest slab
+    Block *end_ = nullptr;
+    std::vector<std::pair<Block *, size_type>> slabs_;
+    std::vector<std::shared_ptr<SlabArena>> adopted_;
+  };
+
+  SlabArena &Arena() {
+    if (!arena_) {
+      arena_ = std::make_shared<SlabArena>();
+    }
+    return *arena_;
+  }
+
+  std::shared_ptr<SlabArena> arena_;
+};
+
+// True for allocators with the pool interface (reserve/release/adopt).
+template <typename Alloc, typename = void>
+struct is_node_pool : std::false_type {};
+
+template <typename Alloc>
+struct is_node_pool<Alloc,
+                    std::void_t<decltype(std::declval<Alloc &>().release()),
+                                decltype(std::declval<Alloc &>().adopt(
+                                    std::declval<const Alloc &>()))>>
+    : std::true_type {};
+
+template <typename Alloc>
+inline constexpr bool is_node_pool_v = is_node_pool<Alloc>::value;
+
+}  // namespace s21
+
+#endif  // S21_NODE_POOL_H
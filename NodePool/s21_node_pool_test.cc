@@ -0,0 +1,173 @@
+#include "s21_node_pool.h"
+
+#include <gtest/gtest.h>
+#include <malloc.h>
+
+#include <set>
+#include <string>
+
+#include "../Map/s21_map.h"
+#include "../Set/s21_set.h"
+
+TEST(NodePoolTest, RecyclesFreedNodes) {
+  s21::NodePool<long> pool;
+  long *first = pool.allocate(1);
+  long *second = pool.allocate(1);
+  EXPECT_NE(first, second);
+  pool.deallocate(first, 1);
+  EXPECT_EQ(pool.allocate(1), first);
+  pool.deallocate(second, 1);
+  pool.deallocate(first, 1);
+}
+
+TEST(NodePoolTest, NodesComeFromOneSlab) {
+  s21::NodePool<long, 64> pool;
+  pool.reserve(64);
+  long *prev = pool.allocate(1);
+  for (int i = 1; i < 64; ++i) {
+    long *next = pool.allocate(1);
+    EXPECT_EQ(next, prev + 1);
+    prev = next;
+  }
+  pool.release();
+}
+
+TEST(NodePoolTest, CopiesShareTheArena) {
+  s21::NodePool<int> pool;
+  pool.reserve(1);
+  s21::NodePool<int> copy(pool);
+  EXPECT_EQ(copy, pool);
+  int *node = copy.allocate(1);
+  pool.deallocate(node, 1);
+
+  s21::NodePool<int> fresh = pool.select_on_container_copy_construction();
+  EXPECT_NE(fresh, pool);
+}
+
+TEST(NodePoolTest, ArrayAllocationsBypassThePool) {
+  s21::NodePool<int> pool;
+  int *array = pool.allocate(10);
+  for (int i = 0; i < 10; ++i) array[i] = i;
+  pool.deallocate(array, 10);
+}
+
+TEST(NodePoolTest, Trait) {
+  EXPECT_TRUE(s21::is_node_pool_v<s21::NodePool<int>>);
+  EXPECT_FALSE(s21::is_node_pool_v<std::allocator<int>>);
+}
+
+TEST(NodePoolTest, MapClearAndReuse) {
+  s21::Map<int, std::string> map;
+  for (int i = 0; i < 10000; ++i) map.insert(i, std::to_string(i));
+  map.clear();
+  EXPECT_TRUE(map.empty());
+  for (int i = 0; i < 100; ++i) map.insert(i, std::to_string(i));
+  EXPECT_EQ(map.size(), 100u);
+  EXPECT_EQ(map.at(42), "42");
+}
+
+TEST(NodePoolTest, MergedNodesOutliveTheSource) {
+  s21::Set<std::string> target = {"a", "c"};
+  {
+    s21::Set<std::string> source = {"b", "c", "d"};
+    target.merge(source);
+  }
+  EXPECT_EQ(target.size(), 4u);
+  for (const char *key : {"a", "b", "c", "d"}) {
+    EXPECT_TRUE(target.contains(key));
+  }
+  target.erase(target.find("b"));
+  target.insert("e");
+  EXPECT_EQ(target.size(), 4u);
+}
+
+TEST(NodePoolTest, MergeBackAndForth) {
+  s21::Set<int> first = {1, 2, 3};
+  s21::Set<int> second = {4, 5, 6};
+  first.merge(second);
+  second.insert(7);
+  second.merge(first);
+  EXPECT_EQ(second.size(), 7u);
+  EXPECT_TRUE(first.empty());
+}
+
+// Bytes currently handed out by malloc, including mmap-ed chunks.
+static size_t HeapBytes() {
+  struct mallinfo2 info = mallinfo2();
+  return info.uordblks + info.hblkhd;
+}
+
+TEST(NodePoolTest, MergingDuplicatesKeepsNoShard) {
+  s21::Set<int> global;
+  for (int i = 0; i < 1000; ++i) global.insert(i);
+  size_t before = 0;
+  for (int round = 0; round < 200; ++round) {
+    if (round == 10) before = HeapBytes();
+    s21::Set<int> shard;
+    for (int i = 0; i < 1000; ++i) shard.insert(i);
+    global.merge(shard);
+    EXPECT_EQ(shard.size(), 1000u);
+  }
+  EXPECT_EQ(global.size(), 1000u);
+  // one retained shard alone would be well over 16 KiB
+  EXPECT_LT(HeapBytes(), before + 4096);
+}
+
+TEST(NodePoolTest, MergeKeepsTheArenasTheDonorAdopted) {
+  s21::Set<int> target = {0};
+  {
+    s21::Set<int> middle = {2, 4};
+    {
+      s21::Set<int> first = {1, 3};
+      middle.merge(first);
+    }
+    target.merge(middle);
+    // drops what middle adopted, target still needs it
+    middle.clear();
+  }
+  for (int round = 0; round < 3; ++round) {
+    s21::Set<int> again = {5, 6};
+    target.merge(again);
+  }
+  EXPECT_EQ(target.size(), 7u);
+  int expected = 0;
+  for (int key : target) EXPECT_EQ(key, expected++);
+}
+
+TEST(NodePoolTest, MovedFromTreeStaysUsable) {
+  s21::Set<int> source = {1, 2, 3};
+  s21::Set<int> target(std::move(source));
+  source.insert(10);
+  EXPECT_EQ(source.size(), 1u);
+  EXPECT_EQ(target.size(), 3u);
+  source.swap(target);
+  EXPECT_EQ(source.size(), 3u);
+  EXPECT_TRUE(target.contains(10));
+}
+
+TEST(NodePoolTest, CopyGetsOwnPool) {
+  s21::Set<int> original = {1, 2, 3};
+  s21::Set<int> copy(original);
+  original.clear();
+  EXPECT_EQ(copy.size(), 3u);
+  EXPECT_TRUE(copy.contains(2));
+}
+
+TEST(NodePoolTest, MatchesStdSet) {
+  s21::Set<int> set;
+  std::set<int> reference;
+  unsigned seed = 7;
+  for (int i = 0; i < 20000; ++i) {
+    seed = seed * 1103515245 + 12345;
+    int key = static_cast<int>(seed % 2000);
+    if (seed & 0x10000) {
+      set.insert(key);
+      reference.insert(key);
+    } else {
+      set.erase(key);
+      reference.erase(key);
+    }
+  }
+  EXPECT_EQ(set.size(), reference.size());
+  EXPECT_TRUE(std::equal(set.begin(), set.end(), reference.begin()));
+}
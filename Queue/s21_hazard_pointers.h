@@ -0,0 +1,172 @@
+#ifndef SRC_S21_HAZARD_POINTERS_H
+#define SRC_S21_HAZARD_POINTERS_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+namespace s21 {
+
+// Process-wide hazard pointer domain used by the lock-free queues to free
+// memory that other threads may still be reading.
+//
+// A thread publishes the pointer it is about to dereference in one of its
+// slots with Protect(); memory handed to Retire() is only freed once no slot
+// of any thread holds it. Each thread claims a record on first use and gives
+// it back when it exits; whatever it retired but could not free yet is left
+// to the other threads.
+class HazardPointers {
+ public:
+  static constexpr size_t kMaxThreads = 128;
+  static constexpr size_t kSlotsPerThread = 2;
+
+  using Deleter = void (*)(void *);
+
+  static HazardPointers &Instance() {
+    static HazardPointers domain;
+    return domain;
+  }
+
+  HazardPointers(const HazardPointers &) = delete;
+  HazardPointers &operator=(const HazardPointers &) = delete;
+
+  ~HazardPointers() {
+    for (const Retired &r : orphans_) {
+      r.deleter(r.ptr);
+    }
+  }
+
+  // Loads src and publishes it in the given slot, retrying until the
+  // published value is still current.
+  template <typename P>
+  P *Protect(size_t slot, const std::atomic<P *> &src) {
+    std::atomic<void *> &hazard = Local().record->slots[slot];
+    P *ptr = src.load();
+    while (true) {
+      hazard.store(ptr);
+      P *again = src.load();
+      if (again == ptr) {
+        return ptr;
+      }
+      ptr = again;
+    }
+  }
+
+  void Clear(size_t slot) {
+    Local().record->slots[slot].store(nullptr, std::memory_order_release);
+  }
+
+  void ClearAll() {
+    for (size_t i = 0; i < kSlotsPerThread; ++i) {
+      Clear(i);
+    }
+  }
+
+  void Retire(void *ptr, Deleter deleter) {
+    ThreadState &local = Local();
+    local.retired.push_back({ptr, deleter});
+    if (local.retired.size() >= kScanThreshold) {
+      Scan(local.retired);
+    }
+  }
+
+ private:
+  static constexpr size_t kScanThreshold = 2 * kMaxThreads * kSlotsPerThread;
+
+  struct alignas(64) Record {
+    std::atomic<bool> active{false};
+    std::atomic<void *> slots[kSlotsPerThread] = {};
+  };
+
+  struct Retired {
+    void *ptr;
+    Deleter deleter;
+  };
+
+  struct ThreadState {
+    Record *record = nullptr;
+    std::vector<Retired> retired;
+
+    ~ThreadState() {
+      if (record) {
+        for (auto &slot : record->slots) {
+          slot.store(nullptr);
+        }
+        HazardPointers &domain = Instance();
+        domain.Scan(retired);
+        domain.Orphan(retired);
+        record->active.store(false, std::memory_order_release);
+      }
+    }
+  };
+
+  HazardPointers() = default;
+
+  ThreadState &Local() {
+    thread_local ThreadState state;
+    if (!state.record) {
+      state.record = Acquire();
+    }
+    return state;
+  }
+
+  Record *Acquire() {
+    for (Record &record : records_) {
+      bool expected = false;
+      if (!record.active.load(std::memory_order_relaxed) &&
+          record.active.compare_exchange_strong(expected, true)) {
+        return &record;
+      }
+    }
+    throw std::runtime_error("Too many threads use hazard pointers");
+  }
+
+  // Frees every retired pointer that no thread has published, adopting the
+  // leftovers of threads that have exited.
+  void Scan(std::vector<Retired> &retired) {
+    {
+      std::lock_guard<std::mutex> lock(orphans_mutex_);
+      retired.insert(retired.end(), orphans_.begin(), orphans_.end());
+      orphans_.clear();
+    }
+
+    std::vector<void *> hazards;
+    for (const Record &record : records_) {
+      if (record.active.load()) {
+        for (const auto &slot : record.slots) {
+          if (void *ptr = slot.load()) {
+            hazards.push_back(ptr);
+          }
+        }
+      }
+    }
+    std::sort(hazards.begin(), hazards.end());
+
+    auto unused = std::partition(retired.begin(), retired.end(),
+                               [&hazards](const Retired &r) {
+                                 return std::binary_search(
+                                     hazards.begin(), hazards.end(), r.ptr);
+                               });
+    for (auto it = unused; it != retired.end(); ++it) {
+      it->deleter(it->ptr);
+    }
+    retired.erase(unused, retired.end());
+  }
+
+  void Orphan(std::vector<Retired> &retired) {
+    std::lock_guard<std::mutex> lock(orphans_mutex_);
+    orphans_.insert(orphans_.end(), retired.begin(), retired.end());
+    retired.clear();
+  }
+
+  Record records_[kMaxThreads];
+  std::mutex orphans_mutex_;
+  std::vector<Retired> orphans_;
+};
+
+}  // namespace s21
+
+#endif  // SRC_S21_HAZARD_POINTERS_H
@@ -0,0 +1,362 @@
+#ifndef SRC_S21_MPMC_QUEUE_H
+#define SRC_S21_MPMC_QUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <thread>
+#include <utility>
+
+#include "s21_hazard_pointers.h"
+
+namespace s21 {
+
+// Bounded lock-free queue for any number of producer and consumer threads
+// (Dmitry Vyukov's design). Every slot carries a sequence number telling
+// whether it is ready to be written for lap n or read for lap n, so a push or
+// pop is one CAS on the shared position plus one release store on the slot.
+//
+// push/pop spin (yielding) while the queue is full/empty; try_push/try_pop
+// fail instead. There is no front(): with several consumers the element could
+// be popped by another thread while the caller still looks at it. size() and
+// empty() are snapshots.
+template <typename T>
+class MpmcQueue {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+
+  explicit MpmcQueue(size_type capacity)
+      : capacity_(RoundUp(capacity)),
+        mask_(capacity_ - 1),
+        cells_(new Cell[capacity_]) {
+    for (size_type i = 0; i < capacity_; ++i) {
+      cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  MpmcQueue(const MpmcQueue &) = delete;
+  MpmcQueue &operator=(const MpmcQueue &) = delete;
+
+  ~MpmcQueue() {
+    size_type pos = dequeue_pos_.load(std::memory_order_relaxed);
+    size_type end = enqueue_pos_.load(std::memory_order_relaxed);
+    for (; pos != end; ++pos) {
+      Cell &cell = cells_[pos & mask_];
+      if (cell.sequence.load(std::memory_order_relaxed) == pos + 1) {
+        cell.Ptr()->~value_type();
+      }
+    }
+  }
+
+  // CAPACITY
+  size_type capacity() const noexcept { return capacity_; }
+
+  size_type size() const noexcept {
+    size_type tail = dequeue_pos_.load(std::memory_order_acquire);
+    size_type head = enqueue_pos_.load(std::memory_order_acquire);
+    return head > tail ? head - tail : 0;
+  }
+
+  bool empty() const noexcept { return size() == 0; }
+
+  // MODIFIERS
+  void push(const_reference value) { emplace(value); }
+  void push(value_type &&value) { emplace(std::move(value)); }
+
+  template <typename... Args>
+  void emplace(Args &&...args) {
+    while (!try_emplace(std::forward<Args>(args)...)) {
+      std::this_thread::yield();
+    }
+  }
+
+  bool try_push(const_reference value) { return try_emplace(value); }
+  bool try_push(value_type &&value) { return try_emplace(std::move(value)); }
+
+  template <typename... Args>
+  bool try_emplace(Args &&...args) {
+    Cell *cell = nullptr;
+    size_type pos = enqueue_pos_.load(std::memory_order_relaxed);
+    while (true) {
+      cell = &cells_[pos & mask_];
+      size_type seq = cell->sequence.load(std::memory_order_acquire);
+      std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq - pos);
+      if (diff == 0) {
+        if (enqueue_pos_.compare_exchange_weak(pos, pos + 1,
+                                               std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (diff < 0) {
+        return false;
+      } else {
+        pos = enqueue_pos_.load(std::memory_order_relaxed);
+      }
+    }
+    try {
+      new (cell->Ptr()) value_type(std::forward<Args>(args)...);
+    } catch (...) {
+      // The slot is already claimed; publish it as an empty lap so the
+      // consumer waiting on it skips ahead instead of hanging.
+      cell->sequence.store(pos + capacity_, std::memory_order_release);
+      throw;
+    }
+    cell->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+  }
+
+  void pop(reference value) {
+    while (!try_pop(value)) {
+      std::this_thread::yield();
+    }
+  }
+
+  bool try_pop(reference value) {
+    Cell *cell = nullptr;
+    size_type pos = dequeue_pos_.load(std::memory_order_relaxed);
+    while (true) {
+      cell = &cells_[pos & mask_];
+      size_type seq = cell->sequence.load(std::memory_order_acquire);
+      std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq - (pos + 1));
+      if (diff == 0) {
+        if (dequeue_pos_.compare_exchange_weak(pos, pos + 1,
+                                               std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (diff < 0) {
+        return false;
+      } else if (seq - pos >= capacity_) {
+        // The lap of pos is over although pos was never popped: a producer
+        // whose constructor threw gave the slot up. If pos is just stale the
+        // CAS fails and reloads it.
+        dequeue_pos_.compare_exchange_weak(pos, pos + 1,
+                                           std::memory_order_relaxed);
+      } else {
+        pos = dequeue_pos_.load(std::memory_order_relaxed);
+      }
+    }
+    value_type *item = cell->Ptr();
+    value = std::move(*item);
+    item->~value_type();
+    cell->sequence.store(pos + capacity_, std::memory_order_release);
+    return true;
+  }
+
+ private:
+  static constexpr size_type kCacheLine = 64;
+
+  struct Cell {
+    std::atomic<size_type> sequence;
+    alignas(value_type) unsigned char storage[sizeof(value_type)];
+
+    value_type *Ptr() noexcept {
+      return std::launder(reinterpret_cast<value_type *>(storage));
+    }
+  };
+
+  static size_type RoundUp(size_type n) {
+    size_type res = 2;
+    while (res < n) {
+      res <<= 1;
+    }
+    return res;
+  }
+
+  const size_type capacity_;
+  const size_type mask_;
+  std::unique_ptr<Cell[]> cells_;
+  alignas(kCacheLine) std::atomic<size_type> enqueue_pos_{0};
+  alignas(kCacheLine) std::atomic<size_type> dequeue_pos_{0};
+};
+
+// Unbounded lock-free MPMC queue: a linked list of fixed-size segments (the
+// FAA array queue of Ramalhete and Correia). Producers and consumers claim
+// slots with one fetch_add on the current segment; only when a segment runs
+// out do they race to link or unlink one. Drained segments are freed through
+// HazardPointers, so no thread can touch a segment after it is released.
+//
+// push never fails, it allocates a new segment when the tail one is full.
+template <typename T, size_t SegmentSize = 1024>
+class SegmentedMpmcQueue {
+  static_assert(SegmentSize >= 2, "Segments must hold at least two elements");
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+
+  SegmentedMpmcQueue() {
+    Segment *first = new Segment(0);
+    head_.store(first);
+    tail_.store(first);
+  }
+
+  SegmentedMpmcQueue(const SegmentedMpmcQueue &) = delete;
+  SegmentedMpmcQueue &operator=(const SegmentedMpmcQueue &) = delete;
+
+  ~SegmentedMpmcQueue() {
+    Segment *segment = head_.load();
+    while (segment) {
+      Segment *next = segment->next.load();
+      delete segment;
+      segment = next;
+    }
+  }
+
+  // CAPACITY
+  size_type size() const {
+    HazardPointers &hp = HazardPointers::Instance();
+    Segment *head = hp.Protect(kHeadSlot, head_);
+    Segment *tail = hp.Protect(kTailSlot, tail_);
+    size_type pushed = tail->base + Clamp(tail->enqueue_idx.load());
+    size_type popped = head->base + Clamp(head->dequeue_idx.load());
+    hp.ClearAll();
+    return pushed > popped ? pushed - popped : 0;
+  }
+
+  bool empty() const { return size() == 0; }
+
+  // MODIFIERS
+  void push(const_reference value) { emplace(value); }
+  void push(value_type &&value) { emplace(std::move(value)); }
+
+  template <typename... Args>
+  void emplace(Args &&...args) {
+    // Built once up front: a claimed slot may turn out to be already given
+    // up by a consumer, and then the value moves on to the next slot.
+    value_type value(std::forward<Args>(args)...);
+    HazardPointers &hp = HazardPointers::Instance();
+    while (true) {
+      Segment *tail = hp.Protect(kTailSlot, tail_);
+      size_type idx = tail->enqueue_idx.fetch_add(1);
+      if (idx >= SegmentSize) {
+        if (tail != tail_.load()) {
+          continue;
+        }
+        Segment *next = tail->next.load();
+        if (next == nullptr) {
+          Segment *segment = new Segment(tail->base + SegmentSize);
+          segment->enqueue_idx.store(1);
+          new (segment->cells[0].Ptr()) value_type(std::move(value));
+          segment->cells[0].state.store(kFull);
+          if (tail->next.compare_exchange_strong(next, segment)) {
+            tail_.compare_exchange_strong(tail, segment);
+            break;
+          }
+          value = std::move(*segment->cells[0].Ptr());
+          delete segment;
+        } else {
+          tail_.compare_exchange_strong(tail, next);
+        }
+        continue;
+      }
+
+      Cell &cell = tail->cells[idx];
+      new (cell.Ptr()) value_type(std::move(value));
+      int expected = kEmpty;
+      if (cell.state.compare_exchange_strong(expected, kFull)) {
+        break;
+      }
+      // a consumer gave up on this slot before we filled it
+      value = std::move(*cell.Ptr());
+      cell.Ptr()->~value_type();
+    }
+    hp.Clear(kTailSlot);
+  }
+
+  void pop(reference value) {
+    while (!try_pop(value)) {
+      std::this_thread::yield();
+    }
+  }
+
+  bool try_pop(reference value) {
+    HazardPointers &hp = HazardPointers::Instance();
+    bool success = false;
+    while (!success) {
+      Segment *head = hp.Protect(kHeadSlot, head_);
+      if (head->dequeue_idx.load() >= head->enqueue_idx.load() &&
+          head->next.load() == nullptr) {
+        break;
+      }
+      size_type idx = head->dequeue_idx.fetch_add(1);
+      if (idx >= SegmentSize) {
+        Segment *next = head->next.load();
+        if (next == nullptr) {
+          break;
+        }
+        // A producer that linked next may not have moved tail_ yet; move it
+        // first, so tail_ never points at a segment that is retired.
+        Segment *tail = head;
+        tail_.compare_exchange_strong(tail, next);
+        if (head_.compare_exchange_strong(head, next)) {
+          hp.Retire(head, &DeleteSegment);
+        }
+        continue;
+      }
+
+      Cell &cell = head->cells[idx];
+      if (cell.state.exchange(kTaken) == kFull) {
+        value_type *item = cell.Ptr();
+        value = std::move(*item);
+        item->~value_type();
+        success = true;
+      }
+    }
+    hp.Clear(kHeadSlot);
+    return success;
+  }
+
+ private:
+  static constexpr size_t kHeadSlot = 0;
+  static constexpr size_t kTailSlot = 1;
+  static constexpr int kEmpty = 0;
+  static constexpr int kFull = 1;
+  static constexpr int kTaken = 2;
+
+  struct Cell {
+    std::atomic<int> state{kEmpty};
+    alignas(value_type) unsigned char storage[sizeof(value_type)];
+
+    value_type *Ptr() noexcept {
+      return std::launder(reinterpret_cast<value_type *>(storage));
+    }
+  };
+
+  struct Segment {
+    explicit Segment(size_type first) : base(first) {}
+
+    ~Segment() {
+      for (Cell &cell : cells) {
+        if (cell.state.load(std::memory_order_relaxed) == kFull) {
+          cell.Ptr()->~value_type();
+        }
+      }
+    }
+
+    alignas(64) std::atomic<size_type> enqueue_idx{0};
+    alignas(64) std::atomic<size_type> dequeue_idx{0};
+    alignas(64) std::atomic<Segment *> next{nullptr};
+    const size_type base;  // number of slots in all earlier segments
+    Cell cells[SegmentSize];
+  };
+
+  static void DeleteSegment(void *segment) {
+    delete static_cast<Segment *>(segment);
+  }
+
+  static size_type Clamp(size_type idx) {
+    return idx < SegmentSize ? idx : SegmentSize;
+  }
+
+  alignas(64) std::atomic<Segment *> head_{nullptr};
+  alignas(64) std::atomic<Segment *> tail_{nullptr};
+};
+
+}  // namespace s21
+
+#endif  // SRC_S21_MPMC_QUEUE_H
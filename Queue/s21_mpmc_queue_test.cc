@@ -0,0 +1,161 @@
+#include "s21_mpmc_queue.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(MpmcQueueTest, CapacityRoundsUpToPowerOfTwo) {
+  s21::MpmcQueue<int> queue(100);
+  EXPECT_EQ(queue.capacity(), 128u);
+  EXPECT_TRUE(queue.empty());
+  EXPECT_EQ(queue.size(), 0u);
+}
+
+TEST(MpmcQueueTest, PushPopOrder) {
+  s21::MpmcQueue<std::string> queue(4);
+  queue.push("one");
+  queue.emplace(3, 'x');
+  EXPECT_EQ(queue.size(), 2u);
+
+  std::string value;
+  queue.pop(value);
+  EXPECT_EQ(value, "one");
+  EXPECT_TRUE(queue.try_pop(value));
+  EXPECT_EQ(value, "xxx");
+  EXPECT_FALSE(queue.try_pop(value));
+}
+
+TEST(MpmcQueueTest, FullQueueRejectsTryPush) {
+  s21::MpmcQueue<int> queue(2);
+  EXPECT_TRUE(queue.try_push(1));
+  EXPECT_TRUE(queue.try_push(2));
+  EXPECT_FALSE(queue.try_push(3));
+  int value = 0;
+  EXPECT_TRUE(queue.try_pop(value));
+  EXPECT_TRUE(queue.try_push(3));
+}
+
+TEST(MpmcQueueTest, DestructorReleasesElements) {
+  auto counter = std::make_shared<int>(0);
+  {
+    s21::MpmcQueue<std::shared_ptr<int>> queue(4);
+    queue.push(counter);
+    queue.push(counter);
+    EXPECT_EQ(counter.use_count(), 3);
+  }
+  EXPECT_EQ(counter.use_count(), 1);
+}
+
+struct ThrowOnNegative {
+  explicit ThrowOnNegative(int v) : value(v) {
+    if (v < 0) throw std::invalid_argument("negative");
+  }
+  ThrowOnNegative() = default;
+  int value = 0;
+};
+
+TEST(MpmcQueueTest, ThrowingConstructorLeavesQueueUsable) {
+  s21::MpmcQueue<ThrowOnNegative> queue(4);
+  queue.emplace(1);
+  EXPECT_THROW(queue.emplace(-1), std::invalid_argument);
+  queue.emplace(2);
+
+  ThrowOnNegative value;
+  EXPECT_TRUE(queue.try_pop(value));
+  EXPECT_EQ(value.value, 1);
+  EXPECT_TRUE(queue.try_pop(value));
+  EXPECT_EQ(value.value, 2);
+  EXPECT_FALSE(queue.try_pop(value));
+}
+
+TEST(SegmentedMpmcQueueTest, GrowsAcrossSegments) {
+  s21::SegmentedMpmcQueue<int, 4> queue;
+  for (int i = 0; i < 100; ++i) {
+    queue.push(i);
+  }
+  EXPECT_EQ(queue.size(), 100u);
+  for (int i = 0; i < 100; ++i) {
+    int value = -1;
+    EXPECT_TRUE(queue.try_pop(value));
+    EXPECT_EQ(value, i);
+  }
+  int value;
+  EXPECT_FALSE(queue.try_pop(value));
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST(SegmentedMpmcQueueTest, DestructorReleasesElements) {
+  auto counter = std::make_shared<int>(0);
+  {
+    s21::SegmentedMpmcQueue<std::shared_ptr<int>, 2> queue;
+    for (int i = 0; i < 5; ++i) queue.push(counter);
+    std::shared_ptr<int> value;
+    queue.pop(value);
+    EXPECT_EQ(counter.use_count(), 6);
+  }
+  EXPECT_EQ(counter.use_count(), 1);
+}
+
+// Several producers push (producer, sequence) pairs; consumers check that the
+// sequence of every producer arrives in order and nothing is lost.
+template <typename Queue>
+static void StressQueue(Queue &queue, int producers, int consumers,
+                        int per_producer) {
+  std::atomic<int> received{0};
+  std::atomic<bool> ordered{true};
+  std::atomic<long long> sum{0};
+  std::vector<std::thread> threads;
+
+  for (int p = 0; p < producers; ++p) {
+    threads.emplace_back([&queue, p, per_producer] {
+      for (int i = 0; i < per_producer; ++i) {
+        queue.push(std::make_pair(p, i));
+      }
+    });
+  }
+  const int total = producers * per_producer;
+  for (int c = 0; c < consumers; ++c) {
+    threads.emplace_back([&, producers] {
+      std::vector<int> last(producers, -1);
+      std::pair<int, int> item;
+      while (received.load() < total) {
+        if (queue.try_pop(item)) {
+          if (item.second <= last[item.first]) ordered = false;
+          last[item.first] = item.second;
+          sum += item.second;
+          ++received;
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) thread.join();
+
+  EXPECT_TRUE(ordered.load());
+  EXPECT_EQ(received.load(), total);
+  EXPECT_EQ(sum.load(), 1LL * producers * per_producer * (per_producer - 1) / 2);
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST(MpmcQueueTest, ManyProducersManyConsumers) {
+  s21::MpmcQueue<std::pair<int, int>> queue(256);
+  StressQueue(queue, 4, 4, 50000);
+}
+
+TEST(SegmentedMpmcQueueTest, ManyProducersManyConsumers) {
+  s21::SegmentedMpmcQueue<std::pair<int, int>, 64> queue;
+  StressQueue(queue, 4, 4, 50000);
+}
+
+// With two slots per segment producers link a new segment on every other
+// push and consumers that keep up drain it at once, so a producer is often
+// preempted after linking a segment and before moving tail_ onto it. The
+// consumers must not free the segment tail_ still points at.
+TEST(SegmentedMpmcQueueTest, ConsumersOvertakeStalledProducers) {
+  s21::SegmentedMpmcQueue<std::pair<int, int>, 2> queue;
+  StressQueue(queue, 8, 4, 20000);
+}
@@ -4,9 +4,14 @@
 //#include <cstddef>  //для использования size_t
 #include <initializer_list>
 #include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <utility>
 
 namespace s21 {
 
+// Queue is a circular buffer: the capacity is always zero or a power of two,
+// so wrapping an index is a single mask, and the buffer doubles when full.
 template <typename T>
 class Queue {
  public:
@@ -23,6 +28,7 @@ class Queue {
   using reference = T &;
   using const_reference = const T &;
   using size_type = size_t;
+  using Allocator = std::allocator<T>;
 
   // Element access
   const_reference front() const;
@@ -31,17 +37,34 @@ class Queue {
   // Capacity
   bool empty() const;
   size_type size() const;
+  size_type capacity() const;
+  void reserve(size_type new_cap);
+  void shrink_to_fit();
 
   // Modifiers
   void push(const_reference value);
+  void push(T &&value);
+  template <typename... Args>
+  reference emplace(Args &&...args);
   void pop();
   void swap(Queue &q);
 
  private:
+  static constexpr size_type kMinCapacity = 8;
+
+  static size_type RoundUp(size_type n);
+  size_type Wrap(size_type index) const { return index & (capacity_ - 1); }
+  void Reallocate(size_type new_cap);
+  void Uncreate();
+
+  Allocator alloc_;
   T *data_;
+  size_type capacity_;
+  size_type head_;  // index of front()
+  size_type tail_;  // index one past back()
   size_type size_;
 };
 }  // namespace s21
 
 #include "s21_queue.tpp"
-#endif  // SRC_S21_QUEUE_H_
\ No newline at end of file
+#endif  // SRC_S21_QUEUE_H_
@@ -4,50 +4,55 @@ namespace s21 {
 
 //______________________________________________________Functions
 template <typename T>
-Queue<T>::Queue() : data_(nullptr), size_(0) {}
+Queue<T>::Queue()
+    : alloc_(), data_(nullptr), capacity_(0), head_(0), tail_(0), size_(0) {}
 
 template <typename T>
-Queue<T>::Queue(const Queue &q) {
-  if (&q != this) {
-    size_ = q.size_;
-    data_ = new T[size_];
-    std::copy(q.data_, q.data_ + size_, data_);
+Queue<T>::Queue(const Queue &q) : Queue() {
+  reserve(q.size_);
+  for (size_type i = 0; i < q.size_; ++i) {
+    push(q.data_[q.Wrap(q.head_ + i)]);
   }
 }
 
 template <typename T>
 Queue<T>::Queue(std::initializer_list<T> const &items) : Queue() {
-  if (items.size() != 0) {
-    size_ = items.size();
-    data_ = new T[size_];
-    std::move(items.begin(), items.end(), data_);
+  reserve(items.size());
+  for (const T &item : items) {
+    push(item);
   }
 }
 
 template <typename T>
-Queue<T>::Queue(Queue &&q) noexcept {
-  size_ = q.size_;
-  data_ = q.data_;
-  q.size_ = 0;
+Queue<T>::Queue(Queue &&q) noexcept
+    : alloc_(),
+      data_(q.data_),
+      capacity_(q.capacity_),
+      head_(q.head_),
+      tail_(q.tail_),
+      size_(q.size_) {
   q.data_ = nullptr;
+  q.capacity_ = q.head_ = q.tail_ = q.size_ = 0;
 }
 
 template <typename T>
 Queue<T>::~Queue() {
-  size_ = 0;
-  delete[] data_;
+  Uncreate();
 }
 
 template <typename T>
 typename Queue<T>::Queue &Queue<T>::operator=(Queue &&q) {
   if (this != &q) {
-    delete[] data_;
+    Uncreate();
 
-    size_ = q.size_;
     data_ = q.data_;
+    capacity_ = q.capacity_;
+    head_ = q.head_;
+    tail_ = q.tail_;
+    size_ = q.size_;
 
-    q.size_ = 0;
     q.data_ = nullptr;
+    q.capacity_ = q.head_ = q.tail_ = q.size_ = 0;
   }
   return *this;
 }
@@ -63,13 +68,33 @@ typename Queue<T>::size_type Queue<T>::size() const {
   return size_;
 }
 
+template <typename T>
+typename Queue<T>::size_type Queue<T>::capacity() const {
+  return capacity_;
+}
+
+template <typename T>
+void Queue<T>::reserve(size_type new_cap) {
+  if (new_cap > capacity_) {
+    Reallocate(RoundUp(new_cap));
+  }
+}
+
+template <typename T>
+void Queue<T>::shrink_to_fit() {
+  size_type new_cap = size_ ? RoundUp(size_) : 0;
+  if (new_cap < capacity_) {
+    Reallocate(new_cap);
+  }
+}
+
 //______________________________________________________Element access
 template <typename T>
 typename Queue<T>::const_reference Queue<T>::front() const {
   if (empty()) {
     throw std::out_of_range("Queue is empty");
   }
-  return data_[0];
+  return data_[head_];
 }
 
 template <typename T>
@@ -77,7 +102,7 @@ typename Queue<T>::const_reference Queue<T>::back() const {
   if (empty()) {
     throw std::out_of_range("Queue is empty");
   }
-  return data_[size_ - 1];
+  return data_[Wrap(tail_ - 1)];
 }
 
 //_______________________________________________________Modifiers
@@ -87,36 +112,97 @@ void Queue<T>::pop() {
     throw std::out_of_range("Queue is empty");
   }
 
-  T *newData = new T[size_ - 1];
-  std::copy(data_ + 1, data_ + size_, newData);
-  delete[] data_;
-  data_ = newData;
+  std::allocator_traits<Allocator>::destroy(alloc_, data_ + head_);
+  head_ = Wrap(head_ + 1);
   size_ -= 1;
 }
 
 template <typename T>
 void Queue<T>::push(const_reference value) {
-  try {
-    T *newData = new T[size_ + 1];
-    std::copy(data_, data_ + size_, newData);
-    newData[size_] = std::move(value);
-    delete[] data_;
-    data_ = newData;
-    size_ += 1;
-  } catch (const std::bad_alloc &e) {
-    std::cerr << "Exception caught: " << e.what() << std::endl;
+  emplace(value);
+}
+
+template <typename T>
+void Queue<T>::push(T &&value) {
+  emplace(std::move(value));
+}
+
+template <typename T>
+template <typename... Args>
+typename Queue<T>::reference Queue<T>::emplace(Args &&...args) {
+  T *slot;
+  if (size_ == capacity_) {
+    // args may refer to an element of this queue, so build the value before
+    // the old buffer is released
+    T value(std::forward<Args>(args)...);
+    Reallocate(capacity_ ? capacity_ * 2 : kMinCapacity);
+    slot = data_ + tail_;
+    std::allocator_traits<Allocator>::construct(alloc_, slot, std::move(value));
+  } else {
+    slot = data_ + tail_;
+    std::allocator_traits<Allocator>::construct(alloc_, slot,
+                                                std::forward<Args>(args)...);
   }
+  tail_ = Wrap(tail_ + 1);
+  size_ += 1;
+  return *slot;
 }
 
 template <typename T>
 void Queue<T>::swap(Queue &q) {
-  T *tempData = data_;
-  data_ = q.data_;
-  q.data_ = tempData;
+  std::swap(data_, q.data_);
+  std::swap(capacity_, q.capacity_);
+  std::swap(head_, q.head_);
+  std::swap(tail_, q.tail_);
+  std::swap(size_, q.size_);
+}
+
+//_______________________________________________________Helpers
+template <typename T>
+typename Queue<T>::size_type Queue<T>::RoundUp(size_type n) {
+  size_type res = kMinCapacity;
+  while (res < n) {
+    res <<= 1;
+  }
+  return res;
+}
 
-  size_type tempSize = size_;
-  size_ = q.size_;
-  q.size_ = tempSize;
+template <typename T>
+void Queue<T>::Reallocate(size_type new_cap) {
+  T *new_data = new_cap ? alloc_.allocate(new_cap) : nullptr;
+  size_type moved = 0;
+  try {
+    for (; moved < size_; ++moved) {
+      std::allocator_traits<Allocator>::construct(
+          alloc_, new_data + moved,
+          std::move_if_noexcept(data_[Wrap(head_ + moved)]));
+    }
+  } catch (...) {
+    std::destroy_n(new_data, moved);
+    alloc_.deallocate(new_data, new_cap);
+    throw;
+  }
+
+  size_type size = size_;
+  Uncreate();
+  data_ = new_data;
+  capacity_ = new_cap;
+  size_ = size;
+  head_ = 0;
+  tail_ = new_cap ? Wrap(size_) : 0;
+}
+
+template <typename T>
+void Queue<T>::Uncreate() {
+  if (data_) {
+    for (size_type i = 0; i < size_; ++i) {
+      std::allocator_traits<Allocator>::destroy(alloc_,
+                                                data_ + Wrap(head_ + i));
+    }
+    alloc_.deallocate(data_, capacity_);
+  }
+  data_ = nullptr;
+  capacity_ = head_ = tail_ = size_ = 0;
 }
 
-}  // namespace s21
\ No newline at end of file
+}  // namespace s21
@@ -2,6 +2,9 @@
 
 #include <gtest/gtest.h>
 
+#include <memory>
+#include <string>
+
 // Tests case for default constructor and empty method
 TEST(QueueTest, DefaultConstructorAndEmptyInt) {
   s21::Queue<int> intQueue;
@@ -285,3 +288,81 @@ TEST(QueueTest, SwapChar) {
   EXPECT_EQ(queue1.back(), '6');
   EXPECT_EQ(queue2.back(), '3');
 }
+
+// Test cases for the circular buffer
+TEST(QueueTest, WrapAround) {
+  s21::Queue<int> queue;
+  for (int i = 0; i < 5; ++i) queue.push(i);
+  for (int i = 0; i < 3; ++i) queue.pop();
+  for (int i = 5; i < 12; ++i) queue.push(i);
+
+  EXPECT_EQ(queue.size(), 9u);
+  EXPECT_EQ(queue.capacity(), 16u);
+  for (int i = 3; i < 12; ++i) {
+    EXPECT_EQ(queue.front(), i);
+    queue.pop();
+  }
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST(QueueTest, GrowthKeepsOrder) {
+  s21::Queue<std::string> queue;
+  for (int i = 0; i < 1000; ++i) {
+    queue.push(std::to_string(i));
+    if (i % 3 == 0) queue.pop();
+  }
+  EXPECT_EQ(queue.back(), "999");
+  int expected = 334;
+  while (!queue.empty()) {
+    EXPECT_EQ(queue.front(), std::to_string(expected++));
+    queue.pop();
+  }
+  EXPECT_EQ(expected, 1000);
+}
+
+TEST(QueueTest, ReserveAndShrink) {
+  s21::Queue<int> queue;
+  queue.reserve(100);
+  EXPECT_EQ(queue.capacity(), 128u);
+  for (int i = 0; i < 10; ++i) queue.push(i);
+  queue.shrink_to_fit();
+  EXPECT_EQ(queue.capacity(), 16u);
+  EXPECT_EQ(queue.front(), 0);
+  EXPECT_EQ(queue.back(), 9);
+}
+
+TEST(QueueTest, PushOwnElementOnGrowth) {
+  s21::Queue<std::string> queue;
+  queue.push("first");
+  while (queue.size() != queue.capacity()) queue.push("filler");
+  queue.push(queue.front());
+  EXPECT_EQ(queue.back(), "first");
+}
+
+TEST(QueueTest, PopEmptyThrows) {
+  s21::Queue<int> queue;
+  EXPECT_THROW(queue.pop(), std::out_of_range);
+  EXPECT_THROW(queue.front(), std::out_of_range);
+  EXPECT_THROW(queue.back(), std::out_of_range);
+}
+
+TEST(QueueTest, EmplaceMoveOnly) {
+  s21::Queue<std::unique_ptr<int>> queue;
+  for (int i = 0; i < 20; ++i) {
+    EXPECT_EQ(*queue.emplace(new int(i)), i);
+  }
+  queue.push(std::make_unique<int>(20));
+  EXPECT_EQ(queue.size(), 21u);
+  for (int i = 0; i <= 20; ++i) {
+    EXPECT_EQ(*queue.front(), i);
+    queue.pop();
+  }
+}
+
+TEST(QueueTest, EmplaceOwnElementOnGrowth) {
+  s21::Queue<std::string> queue;
+  queue.push(std::string(40, 'a'));
+  while (queue.size() != queue.capacity()) queue.emplace(3, 'b');
+  queue.emplace(queue.front());
+  EXPECT_EQ(queue.back(), std::string(40, 'a'));
+}
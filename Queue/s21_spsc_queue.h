@@ -0,0 +1,189 @@
+#ifndef SRC_S21_SPSC_QUEUE_H
+#define SRC_S21_SPSC_QUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace s21 {
+
+// Bounded lock-free queue for exactly one producer thread and one consumer
+// thread. Only the producer may call try_push*, only the consumer may call
+// try_pop* and front(); size() and empty() are safe from either side but are
+// a snapshot.
+//
+// head_ and tail_ are free-running counters reduced by a mask, each written by
+// a single thread. Every side also keeps a plain cached copy of the other
+// side's counter and reloads the atomic only when the cache says the queue is
+// full (or empty), so in the steady state a push or pop touches no shared
+// cache line except the slot itself.
+template <typename T, size_t Capacity>
+class SpscQueue {
+  static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0,
+                "SpscQueue capacity must be a power of two");
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+  using Allocator = std::allocator<T>;
+
+  SpscQueue() : alloc_(), slots_(alloc_.allocate(Capacity)) {}
+
+  SpscQueue(const SpscQueue &) = delete;
+  SpscQueue &operator=(const SpscQueue &) = delete;
+
+  ~SpscQueue() {
+    size_type head = consumer_.head.load(std::memory_order_relaxed);
+    size_type tail = producer_.tail.load(std::memory_order_relaxed);
+    for (; head != tail; ++head) {
+      std::allocator_traits<Allocator>::destroy(alloc_, Slot(head));
+    }
+    alloc_.deallocate(slots_, Capacity);
+  }
+
+  // CAPACITY
+  static constexpr size_type capacity() noexcept { return Capacity; }
+
+  size_type size() const noexcept {
+    size_type head = consumer_.head.load(std::memory_order_acquire);
+    size_type tail = producer_.tail.load(std::memory_order_acquire);
+    return tail - head;
+  }
+
+  bool empty() const noexcept { return size() == 0; }
+
+  // PRODUCER SIDE
+  bool try_push(const_reference value) { return try_emplace(value); }
+  bool try_push(value_type &&value) { return try_emplace(std::move(value)); }
+
+  template <typename... Args>
+  bool try_emplace(Args &&...args) {
+    size_type tail = producer_.tail.load(std::memory_order_relaxed);
+    if (tail - producer_.cached_head == Capacity) {
+      producer_.cached_head = consumer_.head.load(std::memory_order_acquire);
+      if (tail - producer_.cached_head == Capacity) {
+        return false;
+      }
+    }
+    std::allocator_traits<Allocator>::construct(alloc_, Slot(tail),
+                                                std::forward<Args>(args)...);
+    producer_.tail.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Copies up to count items from first and publishes them with a single
+  // release store. Returns how many were pushed.
+  size_type try_push_n(const value_type *first, size_type count) {
+    size_type tail = producer_.tail.load(std::memory_order_relaxed);
+    size_type room = Capacity - (tail - producer_.cached_head);
+    if (room < count) {
+      producer_.cached_head = consumer_.head.load(std::memory_order_acquire);
+      room = Capacity - (tail - producer_.cached_head);
+    }
+    size_type n = count < room ? count : room;
+    size_type done = 0;
+    try {
+      for (; done < n; ++done) {
+        std::allocator_traits<Allocator>::construct(alloc_, Slot(tail + done),
+                                                    first[done]);
+      }
+    } catch (...) {
+      producer_.tail.store(tail + done, std::memory_order_release);
+      throw;
+    }
+    producer_.tail.store(tail + n, std::memory_order_release);
+    return n;
+  }
+
+  // CONSUMER SIDE
+  // Returns the oldest element or nullptr when the queue is empty.
+  value_type *front() noexcept {
+    size_type head = consumer_.head.load(std::memory_order_relaxed);
+    if (head == consumer_.cached_tail) {
+      consumer_.cached_tail = producer_.tail.load(std::memory_order_acquire);
+      if (head == consumer_.cached_tail) {
+        return nullptr;
+      }
+    }
+    return Slot(head);
+  }
+
+  bool try_pop(reference value) {
+    value_type *slot = front();
+    if (!slot) {
+      return false;
+    }
+    value = std::move(*slot);
+    Release(1);
+    return true;
+  }
+
+  // Drops the front element. Returns false when the queue is empty.
+  bool try_pop() {
+    if (!front()) {
+      return false;
+    }
+    Release(1);
+    return true;
+  }
+
+  // Moves up to count items into first and frees their slots with a single
+  // release store. Returns how many were popped.
+  size_type try_pop_n(value_type *first, size_type count) {
+    size_type head = consumer_.head.load(std::memory_order_relaxed);
+    size_type ready = consumer_.cached_tail - head;
+    if (ready < count) {
+      consumer_.cached_tail = producer_.tail.load(std::memory_order_acquire);
+      ready = consumer_.cached_tail - head;
+    }
+    size_type n = count < ready ? count : ready;
+    for (size_type i = 0; i < n; ++i) {
+      first[i] = std::move(*Slot(head + i));
+    }
+    Release(n);
+    return n;
+  }
+
+ private:
+  static constexpr size_type kCacheLine = 64;
+  static constexpr size_type kMask = Capacity - 1;
+
+  value_type *Slot(size_type index) const noexcept {
+    return slots_ + (index & kMask);
+  }
+
+  // Destroys count elements from the front and hands their slots back to the
+  // producer.
+  void Release(size_type count) noexcept {
+    size_type head = consumer_.head.load(std::memory_order_relaxed);
+    for (size_type i = 0; i < count; ++i) {
+      std::allocator_traits<Allocator>::destroy(alloc_, Slot(head + i));
+    }
+    consumer_.head.store(head + count, std::memory_order_release);
+  }
+
+  // Each side's counter and its cached view of the other side share a cache
+  // line that only that side writes.
+  struct alignas(kCacheLine) ProducerState {
+    std::atomic<size_type> tail{0};
+    size_type cached_head = 0;
+  };
+
+  struct alignas(kCacheLine) ConsumerState {
+    std::atomic<size_type> head{0};
+    size_type cached_tail = 0;
+  };
+
+  ProducerState producer_;
+  ConsumerState consumer_;
+  Allocator alloc_;
+  value_type *const slots_;
+};
+
+}  // namespace s21
+
+#endif  // SRC_S21_SPSC_QUEUE_H
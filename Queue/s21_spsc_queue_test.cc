@@ -0,0 +1,125 @@
+#include "s21_spsc_queue.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(SpscQueueTest, DefaultConstructorAndEmpty) {
+  s21::SpscQueue<int, 8> queue;
+  EXPECT_TRUE(queue.empty());
+  EXPECT_EQ(queue.size(), 0u);
+  EXPECT_EQ(queue.capacity(), 8u);
+  EXPECT_EQ(queue.front(), nullptr);
+}
+
+TEST(SpscQueueTest, PushPopOrder) {
+  s21::SpscQueue<int, 4> queue;
+  EXPECT_TRUE(queue.try_push(1));
+  EXPECT_TRUE(queue.try_push(2));
+  EXPECT_EQ(queue.size(), 2u);
+  EXPECT_EQ(*queue.front(), 1);
+
+  int value = 0;
+  EXPECT_TRUE(queue.try_pop(value));
+  EXPECT_EQ(value, 1);
+  EXPECT_TRUE(queue.try_pop(value));
+  EXPECT_EQ(value, 2);
+  EXPECT_FALSE(queue.try_pop(value));
+}
+
+TEST(SpscQueueTest, FullQueueRejectsPush) {
+  s21::SpscQueue<int, 4> queue;
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_TRUE(queue.try_push(i));
+  }
+  EXPECT_FALSE(queue.try_push(4));
+  EXPECT_TRUE(queue.try_pop());
+  EXPECT_TRUE(queue.try_push(4));
+  EXPECT_EQ(queue.size(), 4u);
+}
+
+TEST(SpscQueueTest, BatchPushPop) {
+  s21::SpscQueue<int, 8> queue;
+  std::vector<int> in = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  EXPECT_EQ(queue.try_push_n(in.data(), in.size()), 8u);
+  EXPECT_EQ(queue.try_push_n(in.data(), in.size()), 0u);
+
+  std::vector<int> out(10);
+  EXPECT_EQ(queue.try_pop_n(out.data(), 3), 3u);
+  EXPECT_EQ(out[0], 0);
+  EXPECT_EQ(out[2], 2);
+  EXPECT_EQ(queue.try_push_n(in.data() + 8, 2), 2u);
+  EXPECT_EQ(queue.try_pop_n(out.data(), out.size()), 7u);
+  EXPECT_EQ(out[0], 3);
+  EXPECT_EQ(out[6], 9);
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST(SpscQueueTest, NonTrivialElementsAreDestroyed) {
+  auto counter = std::make_shared<int>(0);
+  {
+    s21::SpscQueue<std::shared_ptr<int>, 4> queue;
+    queue.try_push(counter);
+    queue.try_emplace(counter);
+    EXPECT_EQ(counter.use_count(), 3);
+    queue.try_pop();
+    EXPECT_EQ(counter.use_count(), 2);
+  }
+  EXPECT_EQ(counter.use_count(), 1);
+}
+
+TEST(SpscQueueTest, TwoThreadsKeepOrder) {
+  constexpr int kCount = 1000000;
+  s21::SpscQueue<int, 1024> queue;
+  std::thread producer([&queue] {
+    for (int i = 0; i < kCount; ++i) {
+      while (!queue.try_push(i)) {
+        std::this_thread::yield();
+      }
+    }
+  });
+
+  int expected = 0;
+  bool ordered = true;
+  while (expected < kCount) {
+    int value;
+    if (queue.try_pop(value)) {
+      ordered = ordered && value == expected;
+      ++expected;
+    } else {
+      std::this_thread::yield();
+    }
+  }
+  producer.join();
+  EXPECT_TRUE(ordered);
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST(SpscQueueTest, TwoThreadsBatched) {
+  constexpr int kCount = 1000000;
+  s21::SpscQueue<std::string, 256> queue;
+  std::thread producer([&queue] {
+    std::vector<std::string> batch(32);
+    for (int i = 0; i < kCount; i += 32) {
+      for (int j = 0; j < 32; ++j) batch[j] = std::to_string(i + j);
+      size_t sent = 0;
+      while (sent < batch.size()) {
+        sent += queue.try_push_n(batch.data() + sent, batch.size() - sent);
+      }
+    }
+  });
+
+  std::vector<std::string> batch(64);
+  int expected = 0;
+  bool ordered = true;
+  while (expected < kCount) {
+    size_t n = queue.try_pop_n(batch.data(), batch.size());
+    for (size_t i = 0; i < n; ++i) {
+      ordered = ordered && batch[i] == std::to_string(expected++);
+    }
+  }
+  producer.join();
+  EXPECT_TRUE(ordered);
+}
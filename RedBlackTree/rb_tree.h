@@ -1,16 +1,99 @@
 #ifndef S21_RB_TREE_H
 #define S21_RB_TREE_H
 
+#include <algorithm>    // std::any_of
+#include <cstdint>      // std::uintptr_t
+#include <functional>   // std::less
 #include <iostream>
-#include <limits>   // max_size
-#include <utility>  // std::pair
+#include <iterator>     // std::iterator_traits
+#include <limits>       // max_size
+#include <memory>       // std::allocator_traits
+#include <stdexcept>    // std::invalid_argument
+#include <type_traits>  // std::is_base_of_v
+#include <utility>      // std::pair
+#include <vector>
+
+#include "../NodePool/s21_node_pool.h"
 
 namespace s21 {
 
-template <typename Key, typename Data = char>
-class RedBlackTree {
+// Keeps the comparator of a tree. An empty comparator is kept as a base
+// class, so a stateless one adds nothing to the size of the tree.
+template <typename Compare,
+          bool = std::is_empty_v<Compare> && !std::is_final_v<Compare>>
+class TreeCompare : private Compare {
+ public:
+  TreeCompare() = default;
+  explicit TreeCompare(const Compare& comp) : Compare(comp) {}
+
+  const Compare& comp() const noexcept { return *this; }
+};
+
+template <typename Compare>
+class TreeCompare<Compare, false> {
+ public:
+  TreeCompare() = default;
+  explicit TreeCompare(const Compare& comp) : comp_(comp) {}
+
+  const Compare& comp() const noexcept { return comp_; }
+
+ private:
+  Compare comp_ = Compare();
+};
+
+// Mapped type of a tree that holds keys only, as Set does.
+struct KeyOnly {};
+
+// The element of a tree node: the key and the mapped value. An empty mapped
+// type is kept as a base class, so a node of a set holds nothing but the key.
+template <typename Key, typename Data,
+          bool = std::is_empty_v<Data> && !std::is_final_v<Data>>
+struct NodeElement {
+  template <typename K, typename... Args>
+  NodeElement(std::piecewise_construct_t, K&& key, Args&&... args)
+      : key_(std::forward<K>(key)), value_(std::forward<Args>(args)...) {}
+
+  Data& value() noexcept { return value_; }
+  const Data& value() const noexcept { return value_; }
+
+  Key key_;
+  Data value_;
+};
+
+template <typename Key, typename Data>
+struct NodeElement<Key, Data, true> : private Data {
+  template <typename K, typename... Args>
+  NodeElement(std::piecewise_construct_t, K&& key, Args&&... args)
+      : Data(std::forward<Args>(args)...), key_(std::forward<K>(key)) {}
+
+  Data& value() noexcept { return *this; }
+  const Data& value() const noexcept { return *this; }
+
+  Key key_;
+};
+
+// Size of the subtree under a node, kept only by trees that answer order
+// statistic queries. The other trees inherit the empty version.
+template <bool Counted>
+struct SubtreeCount {
+  size_t count_ = 1;
+};
+
+template <>
+struct SubtreeCount<false> {};
+
+// With OrderStatistics every node also counts the nodes of its subtree,
+// which makes nth(), rank() and distance() O(log n).
+template <typename Key, typename Data = char,
+          typename Compare = std::less<Key>,
+          typename Allocator = std::allocator<std::pair<const Key, Data>>,
+          bool OrderStatistics = false>
+class RedBlackTree : private TreeCompare<Compare> {
+  using CompareBase = TreeCompare<Compare>;
+
  public:
   enum class Colour : char { BLACK, RED };
+  struct NodeBase;
   struct TreeNode;
   class TreeIterator;
   class ConstTreeIterator;
@@ -19,50 +102,72 @@ class RedBlackTree {
   using mapped_type = Data;
   using value_type = std::pair<key_type, mapped_type>;
   using size_type = size_t;
+  using allocator_type = Allocator;
+  using base_ptr = NodeBase*;
   using node_ptr = TreeNode*;
   using iterator = TreeIterator;
   using const_iterator = ConstTreeIterator;
   using iterator_category = std::bidirectional_iterator_tag;
+  using key_compare = Compare;
 
   // CONSTRUCTORS
-  RedBlackTree() : root_(nullptr), size_(0) {}
+  RedBlackTree() : size_(0) { ResetHeader(); }
+
+  explicit RedBlackTree(const key_compare& comp)
+      : CompareBase(comp), size_(0) {
+    ResetHeader();
+  }
 
-  RedBlackTree(std::initializer_list<key_type> const& items)
-      : root_(nullptr), size_(0) {
+  RedBlackTree(std::initializer_list<key_type> const& items) : size_(0) {
+    ResetHeader();
     for (const auto& item : items) {
       insert(item);
     }
   }
 
-  RedBlackTree(std::initializer_list<value_type> const& items)
-      : root_(nullptr), size_(0) {
+  RedBlackTree(std::initializer_list<value_type> const& items) : size_(0) {
+    ResetHeader();
     for (const auto& item : items) {
       insert(item);
     }
   }
 
-  RedBlackTree(const RedBlackTree& other) : root_(nullptr), size_(0) {
-    root_ = CopyTree(other.root_, nullptr);
+  // Builds the tree from keys (or key-value pairs) sorted in ascending
+  // order in O(n), see assign_sorted().
+  template <typename InputIt>
+  static RedBlackTree from_sorted(InputIt first, InputIt last) {
+    RedBlackTree res;
+    res.assign_sorted(first, last);
+    return res;
+  }
+
+  RedBlackTree(const RedBlackTree& other)
+      : CompareBase(other),
+        size_(0),
+        alloc_(node_traits::select_on_container_copy_construction(
+            other.alloc_)) {
+    ResetHeader();
+    SetRoot(CopyTree(other));
     size_ = other.size_;
   }
 
   RedBlackTree(RedBlackTree&& other) noexcept
-      : root_(other.root_), size_(other.size_) {
-    other.root_ = nullptr;
+      : CompareBase(std::move(other)),
+        size_(other.size_),
+        alloc_(std::move(other.alloc_)) {
+    ResetHeader();
+    TakeHeader(other);
     other.size_ = 0;
   }
 
-  ~RedBlackTree() {
-    CleanRecursively(root_);
-    size_ = 0;
-    root_ = nullptr;
-  }
+  ~RedBlackTree() { clear(); }
 
   // ASSIGNEMENT OPERATORS
   RedBlackTree& operator=(const RedBlackTree& other) {
     if (this != &other) {
       clear();
-      root_ = CopyTree(other.root_, nullptr);
+      CompareBase::operator=(other);
+      SetRoot(CopyTree(other));
       size_ = other.size_;
     }
     return *this;
@@ -72,10 +177,11 @@ class RedBlackTree {
     if (this != &other) {
       clear();
 
-      root_ = other.root_;
+      CompareBase::operator=(std::move(other));
+      alloc_ = std::move(other.alloc_);
+      TakeHeader(other);
       size_ = other.size_;
 
-      other.root_ = nullptr;
       other.size_ = 0;
     }
     return *this;
@@ -86,48 +192,107 @@ class RedBlackTree {
   size_type size() const noexcept { return size_; }
   size_type max_size() {
     return std::numeric_limits<size_type>::max() /
-           sizeof(RedBlackTree<key_type, mapped_type>::TreeNode) / 2;
+           sizeof(TreeNode) / 2;
   }
 
+  allocator_type get_allocator() const { return allocator_type(alloc_); }
+
+  key_compare key_comp() const { return CompareBase::comp(); }
+
   // MODIFIERS
+  // With a node pool the nodes are destroyed (when they need it) and then all
+  // slabs are handed back at once instead of freeing node by node.
   void clear() {
-    CleanRecursively(root_);
+    if constexpr (is_node_pool_v<node_allocator>) {
+      if constexpr (!std::is_trivially_destructible_v<TreeNode>) {
+        DestroyTree(Root());
+      }
+      alloc_.release();
+    } else {
+      CleanTree(Root());
+    }
     size_ = 0;
-    root_ = nullptr;
+    ResetHeader();
   }
 
+  // insert() returns end() when the key is already there, emplace() and
+  // try_emplace() return the element that blocked the insertion, as the STL
+  // does. A node is only allocated once the key is known to be new.
   std::pair<iterator, bool> insert(const key_type& value) {
-    bool success = false;
-    node_ptr new_node = new TreeNode(value);
-    success = SimpleInsert(new_node);
-    std::pair<iterator, bool> res = std::make_pair(iterator(nullptr), success);
-    if (success) {
-      res.first = iterator(new_node);
+    std::pair<iterator, bool> res = TryEmplace(value);
+    if (!res.second) {
+      res.first = end();
+    }
+    return res;
+  }
+
+  std::pair<iterator, bool> insert(key_type&& value) {
+    std::pair<iterator, bool> res = TryEmplace(std::move(value));
+    if (!res.second) {
+      res.first = end();
     }
     return res;
   }
 
   std::pair<iterator, bool> insert(const value_type& value) {
-    bool success = false;
-    node_ptr new_node = new TreeNode(value.first, value.second);
-    success = SimpleInsert(new_node);
-    std::pair<iterator, bool> res = std::make_pair(iterator(nullptr), success);
-    if (success) {
-      res.first = iterator(new_node);
+    std::pair<iterator, bool> res = TryEmplace(value.first, value.second);
+    if (!res.second) {
+      res.first = end();
     }
     return res;
   }
 
-  size_type erase(const key_type& key) {
-    size_type res = 0;
-    node_ptr node = Search(key);
-    if (node) {
-      RemoveNode(node);
-      res = 1;
+  std::pair<iterator, bool> insert(value_type&& value) {
+    std::pair<iterator, bool> res =
+        TryEmplace(std::move(value.first), std::move(value.second));
+    if (!res.second) {
+      res.first = end();
     }
     return res;
   }
 
+  // The hint is the position the new element would be inserted before.
+  // Inserting right before or right after the hint skips the descent from
+  // the root; a wrong hint costs one comparison more than insert().
+  iterator insert(iterator hint, const key_type& value) {
+    return EmplaceHint(hint, value);
+  }
+
+  iterator insert(iterator hint, const value_type& value) {
+    return EmplaceHint(hint, value.first, value.second);
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args&&... args) {
+    value_type value(std::forward<Args>(args)...);
+    return TryEmplace(std::move(value.first), std::move(value.second));
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const key_type& key, Args&&... args) {
+    return TryEmplace(key, std::forward<Args>(args)...);
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(key_type&& key, Args&&... args) {
+    return TryEmplace(std::move(key), std::forward<Args>(args)...);
+  }
+
+  // The hinted form: the mapped value is only built from args when key is
+  // new, otherwise the element that is there comes back.
+  template <typename... Args>
+  iterator try_emplace(iterator hint, const key_type& key, Args&&... args) {
+    return EmplaceHint(hint, key, std::forward<Args>(args)...);
+  }
+
+  size_type erase(const key_type& key) { return EraseKey(key); }
+
+  template <typename K, typename C = key_compare,
+            typename = typename C::is_transparent>
+  size_type erase(const K& key) {
+    return EraseKey(key);
+  }
+
   void erase(iterator pos) {
     if (pos != end()) {
       RemoveNode(pos.node());
@@ -135,99 +300,346 @@ class RedBlackTree {
   }
 
   void swap(RedBlackTree& other) noexcept {
-    std::swap(root_, other.root_);
+    std::swap(header_, other.header_);
+    FixHeader();
+    other.FixHeader();
     std::swap(size_, other.size_);
+    std::swap(alloc_, other.alloc_);
+    std::swap<CompareBase>(*this, other);
   }
 
+  // Moves every element of other whose key is not in this tree over here;
+  // the duplicates stay in other, as std::set::merge does. No node is
+  // copied or reallocated. Both trees are walked in order into one sorted
+  // array of nodes, which is then relinked into a balanced tree: O(n + m)
+  // instead of m insertions. When other is much smaller than this tree its
+  // nodes are linked in one by one, in key order, instead.
   void merge(RedBlackTree& other) {
+    if (this == &other || other.empty()) {
+      return;
+    }
     if (this->empty()) {
       *this = std::move(other);
-    } else if (!other.empty()) {
-      node_ptr node = other.root_;
-      if (node) {
-        MergeRecursively(node);
-        other.root_ = nullptr;
-        other.size_ = 0;
+      return;
+    }
+
+    bool linear = other.size_ * kLinearMergeRatio >= size_;
+    std::vector<node_ptr> donors;
+    std::vector<node_ptr> rest;
+    std::vector<node_ptr> merged;
+    donors.reserve(other.size_);
+    rest.reserve(other.size_);
+    if (linear) {
+      merged.reserve(size_ + other.size_);
+    }
+    ForEachInOrder(other.Root(),
+                   [&donors](node_ptr node) { donors.push_back(node); });
+
+    // Both trees stay untouched until it is known that a node moves, so a
+    // merge of nothing but duplicates neither relinks nor adopts anything.
+    bool moved = false;
+    size_type next = 0;
+    if (linear) {
+      ForEachInOrder(Root(), [&](node_ptr node) {
+        for (; next < donors.size() && Less(donors[next]->key_, node->key_);
+             ++next) {
+          Prefetch(donors, next + kPrefetchDistance);
+          merged.push_back(donors[next]);
+        }
+        if (next < donors.size() && !Less(node->key_, donors[next]->key_)) {
+          rest.push_back(donors[next++]);
+        }
+        merged.push_back(node);
+      });
+      merged.insert(merged.end(), donors.begin() + next, donors.end());
+      moved = rest.size() < donors.size();
+    } else {
+      moved = std::any_of(donors.begin(), donors.end(), [this](node_ptr node) {
+        return Search(node->key_) == Header();
+      });
+    }
+    if (!moved) {
+      return;
+    }
+    if constexpr (is_node_pool_v<node_allocator>) {
+      alloc_.adopt(other.alloc_);
+    }
+    other.ResetHeader();
+    other.size_ = 0;
+
+    if (linear) {
+      SetRoot(BuildTree(merged));
+      size_ = merged.size();
+    } else {
+      for (node_ptr node : donors) {
+        base_ptr parent = nullptr;
+        bool bigger = 0;
+        if (FindSlot(node->key_, parent, bigger)) {
+          rest.push_back(node);
+        } else {
+          node->left_ = node->right_ = nullptr;
+          node->set_colour(Colour::RED);
+          LinkNode(node, parent, bigger);
+        }
       }
     }
+    other.SetRoot(other.BuildTree(rest));
+    other.size_ = rest.size();
+  }
+
+  // Replaces the contents with [first, last), which has to be sorted in
+  // ascending order; repeated keys are kept once. Instead of n insertions the
+  // nodes are created in order and linked into a perfectly balanced tree in
+  // one pass, with one slab for all of them when a node pool is used and the
+  // length of the range is known. Throws std::invalid_argument on unsorted
+  // input; if anything throws, the tree is left empty.
+  template <typename InputIt>
+  void assign_sorted(InputIt first, InputIt last) {
+    clear();
+    using category = typename std::iterator_traits<InputIt>::iterator_category;
+    if constexpr (is_node_pool_v<node_allocator> &&
+                  std::is_base_of_v<std::forward_iterator_tag, category>) {
+      alloc_.reserve(static_cast<size_type>(std::distance(first, last)));
+    }
+
+    NodeChain chain;
+    try {
+      for (; first != last; ++first) {
+        const key_type& key = KeyOf(*first);
+        if (chain.tail && !Less(chain.tail->key_, key)) {
+          if (Less(key, chain.tail->key_)) {
+            throw std::invalid_argument("Input is not sorted");
+          }
+          continue;
+        }
+        chain.Append(CreateNodeFrom(*first));
+      }
+    } catch (...) {
+      while (chain.head) {
+        DestroyNode(chain.Pop());
+      }
+      throw;
+    }
+    SetRoot(BuildTree(chain));
+    size_ = chain.size;
   }
 
   // LOOKUP
+  // Each lookup also has an overload for any type key_compare can compare
+  // with key_type, picked when the comparator is transparent (std::less<>
+  // for instance, which takes a std::string_view for std::string keys).
   iterator find(const key_type& key) { return iterator(Search(key)); }
+  const_iterator find(const key_type& key) const {
+    return const_iterator(Search(key));
+  }
+
+  template <typename K, typename C = key_compare,
+            typename = typename C::is_transparent>
+  iterator find(const K& key) {
+    return iterator(Search(key));
+  }
+
+  template <typename K, typename C = key_compare,
+            typename = typename C::is_transparent>
+  const_iterator find(const K& key) const {
+    return const_iterator(Search(key));
+  }
+
+  bool contains(const key_type& key) const { return Search(key) != Header(); }
+
+  template <typename K, typename C = key_compare,
+            typename = typename C::is_transparent>
+  bool contains(const K& key) const {
+    return Search(key) != Header();
+  }
+
+  size_type count(const key_type& key) const { return contains(key); }
+
+  template <typename K, typename C = key_compare,
+            typename = typename C::is_transparent>
+  size_type count(const K& key) const {
+    return contains(key);
+  }
+
+  // The first element not less than key, or end().
+  iterator lower_bound(const key_type& key) {
+    return iterator(LowerBound(key));
+  }
+
+  template <typename K, typename C = key_compare,
+            typename = typename C::is_transparent>
+  iterator lower_bound(const K& key) {
+    return iterator(LowerBound(key));
+  }
+
+  // The first element greater than key, or end().
+  iterator upper_bound(const key_type& key) {
+    return iterator(UpperBound(key));
+  }
+
+  template <typename K, typename C = key_compare,
+            typename = typename C::is_transparent>
+  iterator upper_bound(const K& key) {
+    return iterator(UpperBound(key));
+  }
 
-  bool contains(const key_type& key) { return Search(key); }
+  // ORDER STATISTICS
+  // Only for trees with OrderStatistics. The subtree sizes are kept up to
+  // date by every insertion, removal and rotation, so each of these is one
+  // walk between the root and a node.
+
+  // The k-th smallest element, counting from 0, or end() when k >= size().
+  iterator nth(size_type k) { return iterator(Select(k)); }
+  const_iterator nth(size_type k) const { return const_iterator(Select(k)); }
+
+  // The number of elements less than key, which is the position of
+  // lower_bound(key).
+  size_type rank(const key_type& key) const { return Rank(key); }
+
+  template <typename K, typename C = key_compare,
+            typename = typename C::is_transparent>
+  size_type rank(const K& key) const {
+    return Rank(key);
+  }
+
+  // The number of increments from first to last, as std::distance() gives
+  // in O(n).
+  std::ptrdiff_t distance(const_iterator first, const_iterator last) const {
+    return static_cast<std::ptrdiff_t>(Position(last.base())) -
+           static_cast<std::ptrdiff_t>(Position(first.base()));
+  }
 
   // ITERATORS
-  iterator begin() { return iterator(FindLeftmost()); }
-  const_iterator cbegin() const { return FindLeftmost(); }
+  // The header node stands in for end() and keeps the smallest and the
+  // largest node, so all of these are O(1) and --end() is the last element.
+  iterator begin() noexcept { return iterator(header_.left_); }
+  const_iterator cbegin() const noexcept {
+    return const_iterator(header_.left_);
+  }
 
-  iterator end() noexcept { return iterator(nullptr); }
-  const_iterator cend() const noexcept { return const_iterator(nullptr); }
+  iterator end() noexcept { return iterator(&header_); }
+  const_iterator cend() const noexcept { return const_iterator(Header()); }
 
-  iterator root() { return iterator(root_); }
-  iterator max() { return iterator(FindRightmost(root_)); }
+  // root() is end() in an empty tree, max() is the largest element.
+  iterator root() { return Root() ? iterator(Root()) : end(); }
+  iterator max() noexcept { return iterator(header_.right_); }
 
   // EXTRA METHODS
   void PrettyPrint() {
-    if (root_) {
+    if (Root()) {
       std::cout << "tree size: " << size_ << "\n";
-      PrintHelper(root_, "", true);
+      PrintHelper(Root(), "", true);
     } else {
       std::cout << "tree is empty\n";
     }
   }
 
   // CLASSES AND STRUCTURES
-  struct TreeNode {
-    key_type key_;
-    mapped_type value_;
-    TreeNode* parent_ = nullptr;
-    TreeNode* left_ = nullptr;   // left child
-    TreeNode* right_ = nullptr;  // right child
-    Colour colour_ = Colour::RED;
+  // The links of a node. The header of the tree is one as well: its parent
+  // is the root, its left and right are the smallest and the largest node,
+  // and the root's parent is the header. Nodes are pointer aligned, so the
+  // lowest bit of the parent link is free and holds the colour: a node
+  // costs three pointers on top of its element.
+  struct NodeBase : SubtreeCount<OrderStatistics> {
+    NodeBase* left_ = nullptr;   // left child
+    NodeBase* right_ = nullptr;  // right child
+
+    NodeBase() = default;
+    explicit NodeBase(Colour colour) : parent_(Bits(colour)) {}
+
+    NodeBase* parent() const noexcept {
+      return reinterpret_cast<NodeBase*>(parent_ & ~kColourBit);
+    }
 
-    TreeNode(key_type key, mapped_type value = mapped_type(),
-             Colour colour = Colour::RED)
-        : key_(key),
-          value_(value),
-          parent_(nullptr),
-          left_(nullptr),
-          right_(nullptr),
-          colour_(colour) {}
-
-    node_ptr StepForward(node_ptr node) {
-      node_ptr res = nullptr;
+    void set_parent(NodeBase* parent) noexcept {
+      parent_ = reinterpret_cast<std::uintptr_t>(parent) |
+                (parent_ & kColourBit);
+    }
+
+    Colour colour() const noexcept {
+      return static_cast<Colour>(parent_ & kColourBit);
+    }
+
+    void set_colour(Colour colour) noexcept {
+      parent_ = (parent_ & ~kColourBit) | Bits(colour);
+    }
+
+    // The root is always black and the header red. Only the header is its
+    // own grandparent, or has no parent at all when the tree is empty.
+    bool IsHeader() const noexcept {
+      return colour() == Colour::RED &&
+             (!parent() || parent()->parent() == this);
+    }
+
+    // Stepping past the largest node gives the header, from the header a
+    // step back gives the largest node. Every node has a parent, so the
+    // climb needs no null checks.
+    static NodeBase* StepForward(NodeBase* node) noexcept {
+      NodeBase* res = nullptr;
       if (node->right_) {
         res = node->right_;
         while (res->left_) {
           res = res->left_;
         }
-      } else if (node->parent_) {
-        res = node->parent_;
-        while (res && node == res->right_) {
+      } else {
+        res = node->parent();
+        while (node == res->right_) {
           node = res;
-          res = res->parent_;
+          res = res->parent();
+        }
+        // the root without a right subtree is the header's right child
+        if (node->right_ == res) {
+          res = node;
         }
       }
       return res;
     }
 
-    node_ptr StepBackward(node_ptr node) {
-      node_ptr res = nullptr;
-      if (node->left_) {
+    static NodeBase* StepBackward(NodeBase* node) noexcept {
+      NodeBase* res = nullptr;
+      if (node->IsHeader()) {
+        res = node->right_;
+      } else if (node->left_) {
         res = node->left_;
         while (res->right_) {
           res = res->right_;
         }
-      } else if (node->parent_) {
-        res = node->parent_;
-        while (res && node == res->left_) {
+      } else {
+        res = node->parent();
+        while (node == res->left_) {
           node = res;
-          res = res->parent_;
+          res = res->parent();
         }
       }
       return res;
     }
+
+   private:
+    static constexpr std::uintptr_t kColourBit = 1;
+    static_assert(alignof(NodeBase*) > kColourBit,
+                  "The colour needs a free bit in node addresses");
+
+    static std::uintptr_t Bits(Colour colour) noexcept {
+      return static_cast<std::uintptr_t>(colour);
+    }
+
+    std::uintptr_t parent_ = Bits(Colour::RED);
+  };
+
+  struct TreeNode : NodeBase, NodeElement<key_type, mapped_type> {
+    using Element = NodeElement<key_type, mapped_type>;
+
+    TreeNode(key_type key, mapped_type value = mapped_type(),
+             Colour colour = Colour::RED)
+        : NodeBase(colour),
+          Element(std::piecewise_construct, std::move(key),
+                  std::move(value)) {}
+
+    // Constructs the mapped value in place from args.
+    template <typename K, typename... Args>
+    TreeNode(std::piecewise_construct_t, K&& key, Args&&... args)
+        : Element(std::piecewise_construct, std::forward<K>(key),
+                  std::forward<Args>(args)...) {}
   };
 
   class TreeIterator {
@@ -239,18 +651,16 @@ class RedBlackTree {
     using reference = mapped_type&;
 
     TreeIterator() : curr_(nullptr){};
-    explicit TreeIterator(node_ptr node) : curr_(node){};
+    explicit TreeIterator(base_ptr node) : curr_(node){};
 
-    key_type& operator*() { return curr_->key_; }
+    key_type& operator*() { return node()->key_; }
     TreeIterator& operator++() {
-      curr_ = curr_->StepForward(curr_);
+      curr_ = NodeBase::StepForward(curr_);
       return *this;
     }
 
     TreeIterator& operator--() {
-      if (curr_) {
-        curr_ = curr_->StepBackward(curr_);
-      }
+      curr_ = NodeBase::StepBackward(curr_);
       return *this;
     }
 
@@ -262,11 +672,12 @@ class RedBlackTree {
       return curr_ != other.curr_;
     }
 
-    key_type key() const { return curr_->key_; }
-    node_ptr node() { return curr_; }
+    key_type key() const { return static_cast<node_ptr>(curr_)->key_; }
+    node_ptr node() { return static_cast<node_ptr>(curr_); }
+    base_ptr base() const { return curr_; }
 
    private:
-    node_ptr curr_;
+    base_ptr curr_;
   };
 
   class ConstTreeIterator {
@@ -278,16 +689,17 @@ class RedBlackTree {
     using reference = const mapped_type&;
 
     ConstTreeIterator() : curr_(nullptr){};
-    explicit ConstTreeIterator(node_ptr node) : curr_(node){};
-    const key_type& operator*() const { return curr_->key_; }
+    explicit ConstTreeIterator(base_ptr node) : curr_(node){};
+    ConstTreeIterator(const TreeIterator& other) : curr_(other.base()){};
+    const key_type& operator*() const { return node()->key_; }
 
     ConstTreeIterator& operator++() {
-      curr_ = curr_->StepForward(curr_);
+      curr_ = NodeBase::StepForward(curr_);
       return *this;
     }
 
     ConstTreeIterator& operator--() {
-      curr_ = curr_->StepBackward(curr_);
+      curr_ = NodeBase::StepBackward(curr_);
       return *this;
     }
 
@@ -299,16 +711,18 @@ class RedBlackTree {
       return curr_ != other.curr_;
     }
 
-    const key_type key() const { return curr_->key_; }
-    node_ptr node() const { return curr_; }
+    const key_type key() const { return node()->key_; }
+    node_ptr node() const { return static_cast<node_ptr>(curr_); }
+    base_ptr base() const { return curr_; }
 
    private:
-    node_ptr curr_;
+    base_ptr curr_;
   };
 
  private:
-  void PrintHelper(node_ptr node, std::string indent, bool last) {
-    if (node) {
+  void PrintHelper(base_ptr base, std::string indent, bool last) {
+    if (base) {
+      node_ptr node = Node(base);
       std::cout << indent;
       if (last) {
         std::cout << "R----";
@@ -318,15 +732,17 @@ class RedBlackTree {
         indent += "|    ";
       }
 
-      if (node->colour_ == Colour::RED) {
+      if (node->colour() == Colour::RED) {
         std::cout << "\033[31m";
       }
-      if (node->value_) {
-        std::cout << "{" << node->key_ << ", " << node->value_ << "}";
+      if constexpr (std::is_empty_v<mapped_type>) {
+        std::cout << node->key_;
+      } else if (node->value()) {
+        std::cout << "{" << node->key_ << ", " << node->value() << "}";
       } else {
         std::cout << node->key_;
       }
-      if (node->colour_ == Colour::RED) {
+      if (node->colour() == Colour::RED) {
         std::cout << " (red)\033[0m\n";
       } else {
         std::cout << " (black)\n";
@@ -336,249 +752,704 @@ class RedBlackTree {
     }
   }
 
-  void CleanRecursively(node_ptr node) {
-    if (node) {
-      CleanRecursively(node->left_);
-      CleanRecursively(node->right_);
-      delete node;
+  template <typename... Args>
+  node_ptr CreateNode(Args&&... args) {
+    node_ptr node = node_traits::allocate(alloc_, 1);
+    try {
+      node_traits::construct(alloc_, node, std::forward<Args>(args)...);
+    } catch (...) {
+      node_traits::deallocate(alloc_, node, 1);
+      throw;
     }
+    return node;
   }
 
-  bool SimpleInsert(node_ptr node) {
-    node_ptr curr = root_;
-    node_ptr prev = nullptr;
-    bool bigger = 0;
-    bool success = 1;
-    while (curr != nullptr && success) {
-      prev = curr;
-      if (node->key_ > curr->key_) {
+  void DestroyNode(node_ptr node) {
+    node_traits::destroy(alloc_, node);
+    node_traits::deallocate(alloc_, node, 1);
+  }
+
+  // Takes the subtree apart without recursion or a stack: while the top
+  // node has a left child, that child is rotated up; then the top node is
+  // handed to dispose and its right subtree is next. A rotation moves a node
+  // onto the right spine for good, so this is O(n). Parent links and colours
+  // are not looked at.
+  template <typename Dispose>
+  static void TearDown(base_ptr node, Dispose dispose) {
+    while (node) {
+      base_ptr left = node->left_;
+      if (left) {
+        node->left_ = left->right_;
+        left->right_ = node;
+        node = left;
+      } else {
+        base_ptr right = node->right_;
+        dispose(Node(node));
+        node = right;
+      }
+    }
+  }
+
+  void CleanTree(base_ptr root) {
+    TearDown(root, [this](node_ptr node) { DestroyNode(node); });
+  }
+
+  // Runs the node destructors only, the memory goes back with the pool.
+  void DestroyTree(base_ptr root) {
+    TearDown(root,
+             [this](node_ptr node) { node_traits::destroy(alloc_, node); });
+  }
+
+  static node_ptr Node(base_ptr node) { return static_cast<node_ptr>(node); }
+  static const key_type& KeyAt(base_ptr node) { return Node(node)->key_; }
+
+  base_ptr Root() const { return header_.parent(); }
+  base_ptr Header() const { return const_cast<base_ptr>(&header_); }
+
+  void ResetHeader() {
+    header_.set_parent(nullptr);
+    header_.left_ = header_.right_ = &header_;
+    header_.set_colour(Colour::RED);
+  }
+
+  // Points the root back at this header after the links were copied from
+  // another one.
+  void FixHeader() {
+    if (header_.parent()) {
+      header_.parent()->set_parent(&header_);
+    } else {
+      ResetHeader();
+    }
+  }
+
+  void TakeHeader(RedBlackTree& other) {
+    header_ = other.header_;
+    FixHeader();
+    other.ResetHeader();
+  }
+
+  // Hangs a tree built or copied outside of the header under it.
+  void SetRoot(base_ptr root) {
+    header_.set_parent(root);
+    if (root) {
+      root->set_parent(&header_);
+      header_.left_ = Leftmost(root);
+      header_.right_ = Rightmost(root);
+    } else {
+      ResetHeader();
+    }
+  }
+
+  // Returns the node holding key, or nullptr and the parent (and side) the
+  // new node has to be linked under. The descent makes one comparison per
+  // level; the last node key did not go left of is the only one that can be
+  // equal to it, which one more comparison settles.
+  node_ptr FindSlot(const key_type& key, base_ptr& parent, bool& bigger) {
+    base_ptr curr = Root();
+    base_ptr not_greater = nullptr;
+    parent = &header_;
+    while (curr != nullptr) {
+      parent = curr;
+      bigger = !Less(key, KeyAt(curr));
+      if (bigger) {
+        not_greater = curr;
         curr = curr->right_;
-        bigger = 1;
-      } else if (node->key_ < curr->key_) {
+      } else {
         curr = curr->left_;
-        bigger = 0;
-      } else if (node->key_ == curr->key_) {
-        delete node;
-        success = 0;
       }
     }
+    if (not_greater && !Less(KeyAt(not_greater), key)) {
+      curr = not_greater;
+    }
+    return Node(curr);
+  }
 
+  // Finds the slot next to hint when key belongs right before or right after
+  // it. Returns false when the hint does not help.
+  bool FindHintSlot(base_ptr hint, const key_type& key, base_ptr& parent,
+                    bool& bigger) {
+    bool res = false;
+    if (hint == &header_) {
+      base_ptr last = header_.right_;
+      if (Less(KeyAt(last), key)) {
+        parent = last;
+        bigger = 1;
+        res = true;
+      }
+    } else if (Less(key, KeyAt(hint))) {
+      base_ptr prev =
+          hint == header_.left_ ? nullptr : NodeBase::StepBackward(hint);
+      if (!prev || Less(KeyAt(prev), key)) {
+        // either hint has no left child or prev has no right one
+        parent = hint->left_ ? prev : hint;
+        bigger = hint->left_ != nullptr;
+        res = true;
+      }
+    } else if (Less(KeyAt(hint), key)) {
+      base_ptr next =
+          hint == header_.right_ ? nullptr : NodeBase::StepForward(hint);
+      if (!next || Less(key, KeyAt(next))) {
+        parent = hint->right_ ? next : hint;
+        bigger = hint->right_ == nullptr;
+        res = true;
+      }
+    }
+    return res;
+  }
+
+  void LinkNode(base_ptr node, base_ptr parent, bool bigger) {
+    node->set_parent(parent);
+    if (parent == &header_) {
+      header_.set_parent(node);
+      header_.left_ = header_.right_ = node;
+    } else if (bigger) {
+      parent->right_ = node;
+      if (parent == header_.right_) header_.right_ = node;
+    } else {
+      parent->left_ = node;
+      if (parent == header_.left_) header_.left_ = node;
+    }
+    if constexpr (OrderStatistics) {
+      node->count_ = 1;
+      CountUp(parent, true);
+    }
+    ++size_;
+    FixInsert(node);
+  }
+
+  template <typename K, typename... Args>
+  std::pair<iterator, bool> TryEmplace(K&& key, Args&&... args) {
+    base_ptr parent = nullptr;
+    bool bigger = 0;
+    node_ptr node = FindSlot(key, parent, bigger);
+    bool success = !node;
     if (success) {
-      node->parent_ = prev;
-      if (!prev)
-        root_ = node;
-      else if (bigger)
-        prev->right_ = node;
-      else
-        prev->left_ = node;
-      ++size_;
-      FixInsert(node);
+      node = CreateNode(std::piecewise_construct, std::forward<K>(key),
+                        std::forward<Args>(args)...);
+      LinkNode(node, parent, bigger);
     }
+    return std::make_pair(iterator(node), success);
+  }
 
-    return success;
+  template <typename... Args>
+  iterator EmplaceHint(iterator hint, const key_type& key, Args&&... args) {
+    base_ptr parent = nullptr;
+    bool bigger = 0;
+    node_ptr node = nullptr;
+    if (!Root() || !FindHintSlot(hint.base(), key, parent, bigger)) {
+      node = FindSlot(key, parent, bigger);
+    }
+    if (!node) {
+      node = CreateNode(std::piecewise_construct, key,
+                        std::forward<Args>(args)...);
+      LinkNode(node, parent, bigger);
+    }
+    return iterator(node);
+  }
+
+  static const key_type& KeyOf(const key_type& key) { return key; }
+
+  template <typename K, typename V>
+  static const K& KeyOf(const std::pair<K, V>& value) {
+    return value.first;
   }
 
-  void FixInsert(node_ptr node) {
-    node_ptr uncle = nullptr;
-    while (node->parent_ && node->parent_->colour_ == Colour::RED) {
-      if (IsLeftChild(node->parent_)) {
-        uncle = node->parent_->parent_->right_;
+  node_ptr CreateNodeFrom(const key_type& key) { return CreateNode(key); }
+
+  template <typename K, typename V>
+  node_ptr CreateNodeFrom(const std::pair<K, V>& value) {
+    return CreateNode(value.first, value.second);
+  }
+
+  // Nodes in key order, linked through right_ while they are in no tree.
+  struct NodeChain {
+    node_ptr head = nullptr;
+    node_ptr tail = nullptr;
+    size_type size = 0;
+
+    void Append(node_ptr node) {
+      if (tail) {
+        tail->right_ = node;
+      } else {
+        head = node;
+      }
+      tail = node;
+      node->right_ = nullptr;
+      ++size;
+    }
+
+    node_ptr Pop() {
+      node_ptr res = head;
+      head = Node(head->right_);
+      if (!head) {
+        tail = nullptr;
+      }
+      --size;
+      return res;
+    }
+  };
+
+  // Calls visit for every node of the subtree in key order. The links of a
+  // node are not used after it has been visited, so visit may relink it.
+  template <typename Visit>
+  static void ForEachInOrder(base_ptr node, Visit visit) {
+    // a red-black tree is at most twice as high as a perfectly balanced one
+    base_ptr path[2 * std::numeric_limits<size_type>::digits];
+    int depth = 0;
+    while (node || depth) {
+      for (; node; node = node->left_) {
+        path[depth++] = node;
+      }
+      node = path[--depth];
+      base_ptr right = node->right_;
+      visit(Node(node));
+      node = right;
+    }
+  }
+
+  static void Prefetch(const std::vector<node_ptr>& nodes, size_type pos) {
+    if (pos < nodes.size()) {
+      __builtin_prefetch(nodes[pos]);
+    }
+  }
+
+  // Depth of the deepest level of a balanced tree with count nodes.
+  static int Depth(size_type count) {
+    int res = 0;
+    for (; count > 1; count >>= 1) {
+      ++res;
+    }
+    return res;
+  }
+
+  node_ptr BuildTree(NodeChain& chain) {
+    node_ptr head = chain.head;
+    auto next = [&head]() {
+      node_ptr res = head;
+      head = Node(head->right_);
+      return res;
+    };
+    return BuildBalanced(next, chain.size, nullptr, 0, Depth(chain.size));
+  }
+
+  // The nodes are scattered over memory after a merge, so they are fetched
+  // a few steps ahead of the build.
+  node_ptr BuildTree(const std::vector<node_ptr>& nodes) {
+    size_type pos = 0;
+    auto next = [&nodes, &pos]() {
+      Prefetch(nodes, pos + kPrefetchDistance);
+      return nodes[pos++];
+    };
+    return BuildBalanced(next, nodes.size(), nullptr, 0, Depth(nodes.size()));
+  }
+
+  // Links the next count nodes handed out by next() in key order into a
+  // tree. Splitting at the middle keeps every level but the deepest one
+  // full, so colouring the deepest level red and everything else black
+  // gives a valid red-black tree.
+  template <typename NextNode>
+  node_ptr BuildBalanced(NextNode& next, size_type count, base_ptr parent,
+                         int depth, int deepest) {
+    node_ptr res = nullptr;
+    if (count) {
+      size_type left_count = count / 2;
+      node_ptr left = BuildBalanced(next, left_count, nullptr, depth + 1,
+                                    deepest);
+      res = next();
+      res->set_parent(parent);
+      res->left_ = left;
+      if (left) {
+        left->set_parent(res);
+      }
+      res->right_ = BuildBalanced(next, count - left_count - 1, res,
+                                  depth + 1, deepest);
+      if constexpr (OrderStatistics) {
+        res->count_ = count;
+      }
+      res->set_colour(depth == deepest && depth > 0 ? Colour::RED
+                                                    : Colour::BLACK);
+    }
+    return res;
+  }
+
+  void FixInsert(base_ptr node) {
+    base_ptr uncle = nullptr;
+    while (node != Root() && node->parent()->colour() == Colour::RED) {
+      if (IsLeftChild(node->parent())) {
+        uncle = node->parent()->parent()->right_;
         node = FixLeftChild(node, uncle);
       } else {
-        uncle = node->parent_->parent_->left_;
+        uncle = node->parent()->parent()->left_;
         node = FixRightChild(node, uncle);
       }
     }
-    root_->colour_ = Colour::BLACK;
+    Root()->set_colour(Colour::BLACK);
   }
 
-  node_ptr FixRedUncle(node_ptr node, node_ptr uncle) {
-    uncle->colour_ = Colour::BLACK;
-    node->parent_->colour_ = Colour::BLACK;
-    node->parent_->parent_->colour_ = Colour::RED;
-    return node->parent_->parent_;
+  base_ptr FixRedUncle(base_ptr node, base_ptr uncle) {
+    uncle->set_colour(Colour::BLACK);
+    node->parent()->set_colour(Colour::BLACK);
+    node->parent()->parent()->set_colour(Colour::RED);
+    return node->parent()->parent();
   }
 
-  node_ptr FixRightChild(node_ptr node, node_ptr uncle) {
-    if (uncle && uncle->colour_ == Colour::RED) {
+  base_ptr FixRightChild(base_ptr node, base_ptr uncle) {
+    if (uncle && uncle->colour() == Colour::RED) {
       node = FixRedUncle(node, uncle);
     } else {
       if (IsLeftChild(node)) {
-        node = node->parent_;
+        node = node->parent();
         RotateRight(node);
       }
-      if (node->parent_) {
-        node->parent_->colour_ = Colour::BLACK;
-        if (node->parent_->parent_) {
-          node->parent_->parent_->colour_ = Colour::RED;
-          RotateLeft(node->parent_->parent_);
+      if (node->parent()) {
+        node->parent()->set_colour(Colour::BLACK);
+        if (node->parent()->parent()) {
+          node->parent()->parent()->set_colour(Colour::RED);
+          RotateLeft(node->parent()->parent());
         }
       }
     }
     return node;
   }
 
-  node_ptr FixLeftChild(node_ptr node, node_ptr uncle) {
-    if (uncle && uncle->colour_ == Colour::RED) {
+  base_ptr FixLeftChild(base_ptr node, base_ptr uncle) {
+    if (uncle && uncle->colour() == Colour::RED) {
       node = FixRedUncle(node, uncle);
     } else {
       if (!IsLeftChild(node)) {
-        node = node->parent_;
+        node = node->parent();
         RotateLeft(node);
       }
-      if (node->parent_) {
-        node->parent_->colour_ = Colour::BLACK;
-        if (node->parent_->parent_) {
-          node->parent_->parent_->colour_ = Colour::RED;
-          RotateRight(node->parent_->parent_);
+      if (node->parent()) {
+        node->parent()->set_colour(Colour::BLACK);
+        if (node->parent()->parent()) {
+          node->parent()->parent()->set_colour(Colour::RED);
+          RotateRight(node->parent()->parent());
         }
       }
     }
     return node;
   }
 
-  void RotateLeft(node_ptr x) {
-    node_ptr y = x->right_;
+  void RotateLeft(base_ptr x) {
+    base_ptr y = x->right_;
     x->right_ = y->left_;
     if (y->left_ != nullptr) {
-      y->left_->parent_ = x;
+      y->left_->set_parent(x);
     }
     RotationFixup(x, y);
     y->left_ = x;
-    x->parent_ = y;
+    x->set_parent(y);
+    if constexpr (OrderStatistics) {
+      RecountRotated(x, y);
+    }
   }
 
-  void RotateRight(node_ptr x) {
-    node_ptr y = x->left_;
+  void RotateRight(base_ptr x) {
+    base_ptr y = x->left_;
     x->left_ = y->right_;
     if (y->right_ != nullptr) {
-      y->right_->parent_ = x;
+      y->right_->set_parent(x);
     }
     RotationFixup(x, y);
     y->right_ = x;
-    x->parent_ = y;
+    x->set_parent(y);
+    if constexpr (OrderStatistics) {
+      RecountRotated(x, y);
+    }
   }
 
-  void RotationFixup(node_ptr x, node_ptr y) {
-    y->parent_ = x->parent_;
-    if (x->parent_ == nullptr) {
-      root_ = y;
+  void RotationFixup(base_ptr x, base_ptr y) {
+    y->set_parent(x->parent());
+    if (x == Root()) {
+      header_.set_parent(y);
     } else if (IsLeftChild(x)) {
-      x->parent_->left_ = y;
+      x->parent()->left_ = y;
     } else {
-      x->parent_->right_ = y;
+      x->parent()->right_ = y;
     }
   }
 
-  node_ptr FindLeftmost() {
-    node_ptr res = root_;
-    while (res->left_) {
-      res = res->left_;
+  static size_type Count(base_ptr node) noexcept {
+    return node ? node->count_ : 0;
+  }
+
+  static void Recount(base_ptr node) noexcept {
+    node->count_ = Count(node->left_) + Count(node->right_) + 1;
+  }
+
+  // y took the place of x, so it has the whole subtree now.
+  static void RecountRotated(base_ptr x, base_ptr y) noexcept {
+    y->count_ = x->count_;
+    Recount(x);
+  }
+
+  // Adds a node to (or takes one from) every subtree on the way up from
+  // node to the root.
+  void CountUp(base_ptr node, bool added) noexcept {
+    for (; node != &header_; node = node->parent()) {
+      if (added) {
+        ++node->count_;
+      } else {
+        --node->count_;
+      }
+    }
+  }
+
+  base_ptr Select(size_type k) const {
+    static_assert(OrderStatistics, "The tree keeps no subtree sizes");
+    base_ptr res = Header();
+    base_ptr curr = k < size_ ? Root() : nullptr;
+    while (curr) {
+      size_type left = Count(curr->left_);
+      if (k < left) {
+        curr = curr->left_;
+      } else if (k > left) {
+        k -= left + 1;
+        curr = curr->right_;
+      } else {
+        res = curr;
+        curr = nullptr;
+      }
+    }
+    return res;
+  }
+
+  template <typename K>
+  size_type Rank(const K& key) const {
+    static_assert(OrderStatistics, "The tree keeps no subtree sizes");
+    size_type res = 0;
+    for (base_ptr curr = Root(); curr;) {
+      if (Less(KeyAt(curr), key)) {
+        res += Count(curr->left_) + 1;
+        curr = curr->right_;
+      } else {
+        curr = curr->left_;
+      }
+    }
+    return res;
+  }
+
+  // The number of nodes before node; size() for the header.
+  size_type Position(base_ptr node) const {
+    static_assert(OrderStatistics, "The tree keeps no subtree sizes");
+    size_type res = size_;
+    if (node != Header()) {
+      res = Count(node->left_);
+      for (; node != Root(); node = node->parent()) {
+        base_ptr parent = node->parent();
+        if (node == parent->right_) {
+          res += Count(parent->left_) + 1;
+        }
+      }
     }
     return res;
   }
 
-  const_iterator FindLeftmost() const {
-    node_ptr res = root_;
-    while (res->left_) {
-      res = res->left_;
+  static base_ptr Leftmost(base_ptr node) {
+    while (node->left_) {
+      node = node->left_;
     }
-    return const_iterator(res);
+    return node;
   }
 
-  node_ptr FindRightmost(node_ptr node) {
+  static base_ptr Rightmost(base_ptr node) {
     while (node->right_) {
       node = node->right_;
     }
     return node;
   }
 
-  node_ptr CopyTree(const node_ptr other, node_ptr parent) {
-    node_ptr res = nullptr;
-    if (other) {
-      node_ptr new_node =
-          new TreeNode(other->key_, other->value_, other->colour_);
-      new_node->parent_ = parent;
-      new_node->left_ = CopyTree(other->left_, new_node);
-      new_node->right_ = CopyTree(other->right_, new_node);
-      res = new_node;
+  node_ptr CopyNode(base_ptr other, base_ptr parent) {
+    node_ptr res = CreateNode(KeyAt(other), Node(other)->value(),
+                              other->colour());
+    res->set_parent(parent);
+    if constexpr (OrderStatistics) {
+      res->count_ = other->count_;
     }
     return res;
   }
 
-  node_ptr Search(const key_type& key) {
-    node_ptr res = root_;
-    char flag = 0;
-    while (res && !flag) {
-      if (key < res->key_) {
-        res = res->left_;
-      } else if (key > res->key_) {
-        res = res->right_;
-      } else {
-        flag = 1;
+  // Copies the nodes of other into a tree of the same shape, in preorder
+  // and without recursion: the walk goes down the left links and keeps the
+  // nodes whose right subtree is still to be copied on a stack no deeper
+  // than the tree. With a node pool all the nodes come out of one
+  // reservation. If a copy throws, the nodes made so far are freed.
+  base_ptr CopyTree(const RedBlackTree& other) {
+    base_ptr src = other.Root();
+    if (!src) {
+      return nullptr;
+    }
+    if constexpr (is_node_pool_v<node_allocator>) {
+      alloc_.reserve(other.size_);
+    }
+    struct Pending {
+      base_ptr src;
+      base_ptr dst;
+    };
+    Pending pending[2 * std::numeric_limits<size_type>::digits];
+    int depth = 0;
+    base_ptr root = CopyNode(src, nullptr);
+    base_ptr dst = root;
+    try {
+      while (src) {
+        if (src->right_) {
+          pending[depth++] = {src->right_, dst};
+        }
+        if (src->left_) {
+          dst->left_ = CopyNode(src->left_, dst);
+          src = src->left_;
+          dst = dst->left_;
+        } else if (depth) {
+          Pending next = pending[--depth];
+          next.dst->right_ = CopyNode(next.src, next.dst);
+          src = next.src;
+          dst = next.dst->right_;
+        } else {
+          src = nullptr;
+        }
       }
+    } catch (...) {
+      CleanTree(root);
+      throw;
+    }
+    return root;
+  }
+
+  template <typename K>
+  size_type EraseKey(const K& key) {
+    size_type res = 0;
+    base_ptr node = Search(key);
+    if (node != Header()) {
+      RemoveNode(Node(node));
+      res = 1;
     }
     return res;
   }
 
-  bool HasRedKids(const node_ptr node) {
-    bool res = 0;
-    if (node->right_) {
-      if (node->right_->colour_ == Colour::RED) {
-        res = 1;
+  template <typename A, typename B>
+  bool Less(const A& lhs, const B& rhs) const {
+    return CompareBase::comp()(lhs, rhs);
+  }
+
+  // The lookups give the header, that is end(), when there is no such node.
+  // One comparison per level down to the lower bound, then one more to tell
+  // whether it holds key.
+  template <typename K>
+  base_ptr Search(const K& key) const {
+    base_ptr res = LowerBound(key);
+    if (res != Header() && Less(key, KeyAt(res))) {
+      res = Header();
+    }
+    return res;
+  }
+
+  // Both children are fetched while the key is compared, which hides part
+  // of the miss on the next level of a tree that is larger than the cache.
+  template <typename K>
+  base_ptr LowerBound(const K& key) const {
+    base_ptr res = Header();
+    for (base_ptr curr = Root(); curr;) {
+      __builtin_prefetch(curr->left_);
+      __builtin_prefetch(curr->right_);
+      if (Less(KeyAt(curr), key)) {
+        curr = curr->right_;
+      } else {
+        res = curr;
+        curr = curr->left_;
       }
-    } else if (node->left_) {
-      if (node->left_->colour_ == Colour::RED) {
-        res = 1;
+    }
+    return res;
+  }
+
+  template <typename K>
+  base_ptr UpperBound(const K& key) const {
+    base_ptr res = Header();
+    for (base_ptr curr = Root(); curr;) {
+      if (Less(key, KeyAt(curr))) {
+        res = curr;
+        curr = curr->left_;
+      } else {
+        curr = curr->right_;
       }
     }
     return res;
   }
 
-  bool IsLeftChild(const node_ptr node) {
+  bool HasRedKids(const base_ptr node) {
+    bool res = 0;
+    if (node->right_ && node->right_->colour() == Colour::RED) {
+      res = 1;
+    } else if (node->left_ && node->left_->colour() == Colour::RED) {
+      res = 1;
+    }
+    return res;
+  }
+
+  bool IsLeftChild(const base_ptr node) {
     bool res = false;
-    if (node->parent_) {
-      if (node == node->parent_->left_) res = true;
+    if (node->parent()) {
+      if (node == node->parent()->left_) res = true;
     }
     return res;
   }
 
+  // A node with two children takes over the key of its successor, which is
+  // unlinked instead. Only a node with at most one child can be the
+  // smallest one; the largest can also be such a successor, and then node
+  // holds its key from now on.
   void RemoveNode(node_ptr node) {
-    node_ptr replacement =
-        (!node->left_ || !node->right_) ? node : node->StepForward(node);
+    node_ptr replacement = (!node->left_ || !node->right_)
+                               ? node
+                               : Node(NodeBase::StepForward(node));
 
-    node_ptr child =
+    base_ptr child =
         replacement->left_ ? replacement->left_ : replacement->right_;
 
     if (child) {
-      child->parent_ = replacement->parent_;
+      child->set_parent(replacement->parent());
     }
 
-    if (!replacement->parent_) {
-      root_ = child;
+    if (replacement == Root()) {
+      header_.set_parent(child);
     } else {
       if (IsLeftChild(replacement)) {
-        replacement->parent_->left_ = child;
+        replacement->parent()->left_ = child;
       } else {
-        replacement->parent_->right_ = child;
+        replacement->parent()->right_ = child;
+      }
+    }
+
+    if (replacement == header_.left_) {
+      header_.left_ = child ? Leftmost(child) : replacement->parent();
+    }
+    if (replacement == header_.right_) {
+      if (replacement != node) {
+        header_.right_ = node;
+      } else {
+        header_.right_ = child ? Rightmost(child) : replacement->parent();
       }
     }
 
     if (replacement != node) {
       node->key_ = std::move(replacement->key_);
-      node->value_ = std::move(replacement->value_);
+      node->value() = std::move(replacement->value());
+    }
+
+    if constexpr (OrderStatistics) {
+      CountUp(replacement->parent(), false);
     }
 
-    if (replacement->colour_ == Colour::BLACK) {
-      FixDoubleBlack(child, replacement->parent_);
+    if (replacement->colour() == Colour::BLACK) {
+      FixDoubleBlack(child, replacement->parent());
     }
 
-    delete replacement;
+    DestroyNode(replacement);
     --size_;
   }
 
-  void FixDoubleBlack(node_ptr child, node_ptr parent) {
-    while ((!child || child->colour_ == Colour::BLACK) && child != root_) {
+  void FixDoubleBlack(base_ptr child, base_ptr parent) {
+    while ((!child || child->colour() == Colour::BLACK) && child != Root()) {
       if (child == parent->left_) {
         child = HandleLeftKid(child, parent);
       } else {
@@ -587,98 +1458,81 @@ class RedBlackTree {
     }
 
     if (child) {
-      child->colour_ = Colour::BLACK;
+      child->set_colour(Colour::BLACK);
     }
   }
 
-  node_ptr HandleLeftKid(node_ptr child, node_ptr parent) {
-    node_ptr bro = parent->right_;
-    if (bro->colour_ == Colour::RED) {
-      bro->colour_ = Colour::BLACK;
-      parent->colour_ = Colour::RED;
+  base_ptr HandleLeftKid(base_ptr child, base_ptr& parent) {
+    base_ptr bro = parent->right_;
+    if (bro->colour() == Colour::RED) {
+      bro->set_colour(Colour::BLACK);
+      parent->set_colour(Colour::RED);
       RotateLeft(parent);
       bro = parent->right_;
     }
     if (HasRedKids(bro)) {
-      if (!bro->right_ || bro->right_->colour_ == Colour::BLACK) {
-        if (bro->left_) bro->left_->colour_ = Colour::BLACK;
-        bro->colour_ = Colour::RED;
+      if (!bro->right_ || bro->right_->colour() == Colour::BLACK) {
+        if (bro->left_) bro->left_->set_colour(Colour::BLACK);
+        bro->set_colour(Colour::RED);
         RotateRight(bro);
         bro = parent->right_;
       }
-      bro->colour_ = parent->colour_;
-      parent->colour_ = Colour::BLACK;
-      if (bro->right_) bro->right_->colour_ = Colour::BLACK;
+      bro->set_colour(parent->colour());
+      parent->set_colour(Colour::BLACK);
+      if (bro->right_) bro->right_->set_colour(Colour::BLACK);
       RotateLeft(parent);
-      child = root_;
+      child = Root();
     } else {
-      bro->colour_ = Colour::RED;
+      bro->set_colour(Colour::RED);
       child = parent;
-      parent = child->parent_;
+      parent = child->parent();
     }
     return child;
   }
 
-  node_ptr HandleRightKid(node_ptr child, node_ptr parent) {
-    node_ptr bro = parent->left_;
-    if (bro->colour_ == Colour::RED) {
-      bro->colour_ = Colour::BLACK;
-      parent->colour_ = Colour::RED;
+  base_ptr HandleRightKid(base_ptr child, base_ptr& parent) {
+    base_ptr bro = parent->left_;
+    if (bro->colour() == Colour::RED) {
+      bro->set_colour(Colour::BLACK);
+      parent->set_colour(Colour::RED);
       RotateRight(parent);
       bro = parent->left_;
     }
 
     if (HasRedKids(bro)) {
-      if (!bro->left_ || bro->left_->colour_ == Colour::BLACK) {
-        bro->right_->colour_ = Colour::BLACK;
-        bro->colour_ = Colour::RED;
+      if (!bro->left_ || bro->left_->colour() == Colour::BLACK) {
+        bro->right_->set_colour(Colour::BLACK);
+        bro->set_colour(Colour::RED);
         RotateLeft(bro);
         bro = parent->left_;
       }
 
-      bro->colour_ = parent->colour_;
-      parent->colour_ = Colour::BLACK;
-      bro->left_->colour_ = Colour::BLACK;
+      bro->set_colour(parent->colour());
+      parent->set_colour(Colour::BLACK);
+      bro->left_->set_colour(Colour::BLACK);
       RotateRight(parent);
-      child = root_;
+      child = Root();
     } else {
-      bro->colour_ = Colour::RED;
+      bro->set_colour(Colour::RED);
       child = parent;
-      parent = child->parent_;
+      parent = child->parent();
     }
 
     return child;
   }
 
-  void MergeRecursively(node_ptr node) {
-    if (node) {
-      node_ptr left = node->left_;
-      node_ptr right = node->right_;
+  // merge() relinks both trees when other has at least 1/kLinearMergeRatio
+  // as many nodes as this tree, below that inserting one by one is faster
+  static constexpr size_type kLinearMergeRatio = 4;
+  static constexpr size_type kPrefetchDistance = 8;
 
-      if (node->parent_) {
-        if (IsLeftChild(node)) {
-          node->parent_->left_ = nullptr;
-        } else {
-          node->parent_->right_ = nullptr;
-        }
-        node->parent_ = nullptr;
-      }
-      if (node->left_) {
-        node->left_->parent_ = nullptr;
-        node->left_ = nullptr;
-      } else if (node->right_) {
-        node->right_->parent_ = nullptr;
-        node->right_ = nullptr;
-      }
-      node->colour_ = Colour::RED;
-      SimpleInsert(node);
-      MergeRecursively(left);
-      MergeRecursively(right);
-    }
-  }
+  using node_allocator = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<TreeNode>;
+  using node_traits = std::allocator_traits<node_allocator>;
 
-  node_ptr root_;
+  NodeBase header_;
   size_type size_ = 0;
+  node_allocator alloc_;
 };
 
 }  // namespace s21
@@ -1,3 +1,11 @@
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <vector>
+
 #include "gtest/gtest.h"
 #include "rb_tree.h"
 
@@ -743,3 +751,594 @@ TEST(RedBlackTreeTest, MergeTest) {
   tree.merge(tree2);
   EXPECT_EQ(tree.size(), 16u);
 }
+
+TEST(RedBlackTreeTest, TryEmplaceReturnsExisting) {
+  s21::RedBlackTree<int, char> tree{{1, 'a'}, {2, 'b'}};
+  auto res = tree.try_emplace(2, 'z');
+  EXPECT_FALSE(res.second);
+  EXPECT_EQ(res.first.node()->value_, 'b');
+  res = tree.try_emplace(3, 'c');
+  EXPECT_TRUE(res.second);
+  EXPECT_EQ(res.first.node()->value_, 'c');
+  EXPECT_EQ(tree.size(), 3u);
+}
+
+TEST(RedBlackTreeTest, EmplaceTest) {
+  s21::RedBlackTree<int, char> tree{1, 2, 3};
+  auto res = tree.emplace(4, 'd');
+  EXPECT_TRUE(res.second);
+  EXPECT_EQ(*res.first, 4);
+  res = tree.emplace(4, 'e');
+  EXPECT_FALSE(res.second);
+  EXPECT_EQ(res.first.node()->value_, 'd');
+  EXPECT_EQ(tree.size(), 4u);
+}
+
+TEST(RedBlackTreeTest, HintedInsertTest) {
+  s21::RedBlackTree<int, char> tree;
+  // right hints: at end(), before the successor and after the predecessor
+  for (int i = 0; i < 100; i += 2) {
+    tree.insert(tree.end(), i);
+  }
+  for (int i = 1; i < 100; i += 4) {
+    tree.insert(tree.find(i + 1), i);
+  }
+  for (int i = 3; i < 100; i += 4) {
+    auto hint = tree.find(i - 1);
+    tree.insert(hint, i);
+  }
+  // wrong hints and duplicates
+  auto it = tree.insert(tree.begin(), 150);
+  EXPECT_EQ(*it, 150);
+  it = tree.insert(tree.end(), 50);
+  EXPECT_EQ(*it, 50);
+  it = tree.insert(tree.find(10), -1);
+  EXPECT_EQ(*it, -1);
+
+  EXPECT_EQ(tree.size(), 102u);
+  int expected = -1;
+  for (auto i = tree.begin(); i != tree.end(); ++i) {
+    EXPECT_EQ(*i, expected);
+    expected = expected == 99 ? 150 : expected + 1;
+  }
+}
+
+// Returns the black height of the subtree, or -1 when a red-black rule or a
+// parent link is broken.
+using IntTree = s21::RedBlackTree<int, char>;
+
+static int CheckedBlackHeight(const IntTree::NodeBase* node,
+                              const IntTree::NodeBase* parent) {
+  using Colour = IntTree::Colour;
+  if (!node) {
+    return 1;
+  }
+  if (node->parent() != parent) {
+    return -1;
+  }
+  bool red = node->colour() == Colour::RED;
+  if (red && ((node->left_ && node->left_->colour() == Colour::RED) ||
+              (node->right_ && node->right_->colour() == Colour::RED))) {
+    return -1;
+  }
+  int left = CheckedBlackHeight(node->left_, node);
+  int right = CheckedBlackHeight(node->right_, node);
+  if (left < 0 || left != right) {
+    return -1;
+  }
+  return left + (red ? 0 : 1);
+}
+
+// The root hangs under the header, which is end().
+static int CheckedBlackHeight(IntTree& tree) {
+  return tree.empty() ? 1
+                      : CheckedBlackHeight(tree.root().base(),
+                                           tree.end().base());
+}
+
+TEST(RedBlackTreeTest, FromSortedTest) {
+  for (int n = 0; n < 70; ++n) {
+    std::vector<int> keys(n);
+    for (int i = 0; i < n; ++i) {
+      keys[i] = i * 2;
+    }
+    auto tree = s21::RedBlackTree<int, char>::from_sorted(keys.begin(),
+                                                          keys.end());
+    EXPECT_EQ(tree.size(), static_cast<size_t>(n));
+    EXPECT_GT(CheckedBlackHeight(tree), 0);
+    EXPECT_TRUE(std::equal(keys.begin(), keys.end(), tree.begin()));
+    if (n) {
+      tree.insert(-1);
+      tree.erase(keys[n / 2]);
+      EXPECT_GT(CheckedBlackHeight(tree), 0);
+    }
+  }
+}
+
+TEST(RedBlackTreeTest, AssignSortedTest) {
+  s21::RedBlackTree<int, char> tree{100, 200};
+  std::vector<std::pair<int, char>> values{{1, 'a'}, {1, 'b'}, {2, 'c'}};
+  tree.assign_sorted(values.begin(), values.end());
+  EXPECT_EQ(tree.size(), 2u);
+  EXPECT_FALSE(tree.contains(100));
+  EXPECT_EQ(tree.find(1).node()->value_, 'a');
+  EXPECT_EQ(tree.find(2).node()->value_, 'c');
+
+  std::vector<int> unsorted{1, 3, 2};
+  EXPECT_THROW(tree.assign_sorted(unsorted.begin(), unsorted.end()),
+               std::invalid_argument);
+  EXPECT_TRUE(tree.empty());
+}
+
+TEST(RedBlackTreeTest, MergeKeepsDuplicatesTest) {
+  // both the linear path and the one-by-one path for small donors
+  for (int donor_size : {3, 40, 400}) {
+    std::vector<int> mine;
+    std::vector<int> theirs;
+    for (int i = 0; i < 400; i += 2) {
+      mine.push_back(i);
+    }
+    for (int i = 0; i < donor_size; ++i) {
+      theirs.push_back(i * 3);
+    }
+    auto tree = IntTree::from_sorted(mine.begin(), mine.end());
+    auto other = IntTree::from_sorted(theirs.begin(), theirs.end());
+    tree.merge(other);
+
+    std::vector<int> merged;
+    std::vector<int> dups;
+    std::set_union(mine.begin(), mine.end(), theirs.begin(), theirs.end(),
+                   std::back_inserter(merged));
+    std::set_intersection(mine.begin(), mine.end(), theirs.begin(),
+                          theirs.end(), std::back_inserter(dups));
+    EXPECT_EQ(tree.size(), merged.size());
+    EXPECT_TRUE(std::equal(merged.begin(), merged.end(), tree.begin()));
+    EXPECT_EQ(other.size(), dups.size());
+    EXPECT_TRUE(std::equal(dups.begin(), dups.end(), other.begin()));
+    EXPECT_GT(CheckedBlackHeight(tree), 0);
+    EXPECT_GT(CheckedBlackHeight(other), 0);
+  }
+}
+
+// Counts its calls, so it is also a comparator with state.
+struct CountingLess {
+  int* calls = nullptr;
+
+  bool operator()(int lhs, int rhs) const {
+    ++*calls;
+    return lhs < rhs;
+  }
+};
+
+static int Height(const s21::RedBlackTree<int, char, CountingLess>::NodeBase*
+                      node) {
+  return node ? 1 + std::max(Height(node->left_), Height(node->right_)) : 0;
+}
+
+TEST(RedBlackTreeTest, CustomOrderTest) {
+  s21::RedBlackTree<int, char, std::greater<int>> tree{3, 1, 4, 5, 9, 2, 6};
+  std::vector<int> expected = {9, 6, 5, 4, 3, 2, 1};
+  EXPECT_TRUE(std::equal(expected.begin(), expected.end(), tree.begin()));
+  EXPECT_EQ(*tree.lower_bound(7), 6);
+  EXPECT_EQ(*tree.upper_bound(6), 5);
+  EXPECT_EQ(tree.upper_bound(1), tree.end());
+  EXPECT_FALSE(tree.insert(4).second);
+  EXPECT_EQ(tree.erase(4), 1u);
+  EXPECT_FALSE(tree.contains(4));
+  EXPECT_TRUE(tree.key_comp()(2, 1));
+}
+
+TEST(RedBlackTreeTest, StatefulComparatorTest) {
+  int calls = 0;
+  int other_calls = 0;
+  s21::RedBlackTree<int, char, CountingLess> tree(CountingLess{&calls});
+  for (int i = 0; i < 1000; ++i) {
+    tree.insert((i * 7919) % 1000);
+  }
+  EXPECT_GT(calls, 0);
+
+  // one comparison per level plus one, whether the key is there or not
+  int height = Height(tree.root().node());
+  for (int key = -1; key <= 1000; ++key) {
+    calls = 0;
+    tree.find(key);
+    EXPECT_LE(calls, height + 1);
+  }
+
+  auto copy = tree;
+  s21::RedBlackTree<int, char, CountingLess> other(
+      CountingLess{&other_calls});
+  other.swap(copy);
+  calls = 0;
+  other.contains(5);
+  EXPECT_GT(calls, 0);
+  EXPECT_EQ(other_calls, 0);
+  EXPECT_EQ(copy.key_comp().calls, &other_calls);
+}
+
+TEST(RedBlackTreeTest, EmptyComparatorTakesNoSpaceTest) {
+  struct Layout {
+    s21::RedBlackTree<int, char>::NodeBase header;
+    size_t size;
+    std::allocator<int> alloc;
+  };
+  EXPECT_EQ(sizeof(s21::RedBlackTree<int, char>), sizeof(Layout));
+  EXPECT_EQ(sizeof(s21::RedBlackTree<int, char, std::greater<int>>),
+            sizeof(Layout));
+}
+
+// The colour hides in the parent link and a set node has no mapped value,
+// so a node is three pointers and the key.
+TEST(RedBlackTreeTest, NodeSizeTest) {
+  struct Links {
+    void* links[3];
+  };
+  struct KeyNode {
+    void* links[3];
+    int key;
+  };
+  struct PairNode {
+    void* links[3];
+    int key;
+    int value;
+  };
+  using SetTree = s21::RedBlackTree<int, s21::KeyOnly>;
+  using MapTree = s21::RedBlackTree<int, int>;
+  EXPECT_EQ(sizeof(SetTree::NodeBase), sizeof(Links));
+  EXPECT_EQ(sizeof(SetTree::TreeNode), sizeof(KeyNode));
+  EXPECT_EQ(sizeof(MapTree::TreeNode), sizeof(PairNode));
+
+  SetTree tree{3, 1, 2};
+  SetTree::NodeBase* root = tree.root().base();
+  EXPECT_EQ(root->colour(), SetTree::Colour::BLACK);
+  EXPECT_EQ(root->parent(), tree.end().base());
+  root->set_parent(root->parent());
+  EXPECT_EQ(root->colour(), SetTree::Colour::BLACK);
+  EXPECT_EQ(root->left_->colour(), SetTree::Colour::RED);
+  EXPECT_EQ(root->left_->parent(), root);
+}
+
+TEST(RedBlackTreeTest, EndDecrementTest) {
+  IntTree empty;
+  EXPECT_EQ(empty.begin(), empty.end());
+  EXPECT_EQ(empty.max(), empty.end());
+
+  IntTree tree{4, 2, 5, 1, 3};
+  auto it = tree.end();
+  --it;
+  EXPECT_EQ(*it, 5);
+  EXPECT_EQ(it, tree.max());
+  std::vector<int> backwards;
+  for (it = tree.end(); it != tree.begin();) {
+    --it;
+    backwards.push_back(*it);
+  }
+  EXPECT_EQ(backwards, std::vector<int>({5, 4, 3, 2, 1}));
+  auto cit = tree.cend();
+  --cit;
+  EXPECT_EQ(*cit, 5);
+
+  // the root as the largest node, with no right subtree
+  IntTree pair{2, 1};
+  EXPECT_EQ(*pair.root(), 2);
+  EXPECT_EQ(++pair.max(), pair.end());
+  EXPECT_EQ(*--pair.end(), 2);
+}
+
+// begin() and max() are kept by the tree instead of searched for, so they
+// are checked after every kind of change against a std::set.
+static void ExpectSameExtremes(IntTree& tree, const std::set<int>& expected) {
+  ASSERT_EQ(tree.size(), expected.size());
+  if (expected.empty()) {
+    EXPECT_EQ(tree.begin(), tree.end());
+    EXPECT_EQ(tree.max(), tree.end());
+  } else {
+    EXPECT_EQ(*tree.begin(), *expected.begin());
+    EXPECT_EQ(*tree.max(), *expected.rbegin());
+    EXPECT_EQ(*tree.cbegin(), *expected.begin());
+  }
+  EXPECT_TRUE(std::equal(expected.begin(), expected.end(), tree.begin()));
+  EXPECT_GT(CheckedBlackHeight(tree), 0);
+}
+
+TEST(RedBlackTreeTest, ExtremesFollowChangesTest) {
+  std::mt19937 gen(5);
+  IntTree tree;
+  std::set<int> expected;
+  for (int step = 0; step < 3000; ++step) {
+    int key = static_cast<int>(gen() % 200);
+    switch (gen() % 5) {
+      case 0:
+      case 1:
+        tree.insert(key);
+        expected.insert(key);
+        break;
+      case 2:
+        EXPECT_EQ(tree.erase(key), expected.erase(key));
+        break;
+      case 3:
+        if (!expected.empty()) {
+          bool smallest = gen() % 2;
+          tree.erase(smallest ? tree.begin() : tree.max());
+          expected.erase(smallest ? expected.begin()
+                                  : std::prev(expected.end()));
+        }
+        break;
+      default:
+        tree.insert(tree.end(), key);
+        expected.insert(key);
+    }
+    ExpectSameExtremes(tree, expected);
+  }
+}
+
+TEST(RedBlackTreeTest, ExtremesFollowWholeTreeChangesTest) {
+  IntTree tree{5, 3, 8};
+  IntTree copy(tree);
+  copy.insert(1);
+  ExpectSameExtremes(copy, {1, 3, 5, 8});
+  ExpectSameExtremes(tree, {3, 5, 8});
+
+  IntTree other{10, 20};
+  tree.swap(other);
+  ExpectSameExtremes(tree, {10, 20});
+  ExpectSameExtremes(other, {3, 5, 8});
+  IntTree empty;
+  tree.swap(empty);
+  ExpectSameExtremes(tree, {});
+  ExpectSameExtremes(empty, {10, 20});
+
+  IntTree moved(std::move(other));
+  ExpectSameExtremes(moved, {3, 5, 8});
+  ExpectSameExtremes(other, {});
+  other = std::move(moved);
+  moved.insert(4);
+  ExpectSameExtremes(other, {3, 5, 8});
+  ExpectSameExtremes(moved, {4});
+
+  copy = other;
+  ExpectSameExtremes(copy, {3, 5, 8});
+  std::vector<int> sorted = {0, 2, 9};
+  copy.assign_sorted(sorted.begin(), sorted.end());
+  ExpectSameExtremes(copy, {0, 2, 9});
+  copy.merge(other);
+  ExpectSameExtremes(copy, {0, 2, 3, 5, 8, 9});
+  ExpectSameExtremes(other, {});
+  IntTree small{-1, 100};
+  copy.merge(small);
+  ExpectSameExtremes(copy, {-1, 0, 2, 3, 5, 8, 9, 100});
+  copy.clear();
+  ExpectSameExtremes(copy, {});
+}
+
+TEST(RedBlackTreeTest, IteratorRoundTripTest) {
+  std::mt19937 gen(22);
+  IntTree tree;
+  std::set<int> expected;
+  for (int i = 0; i < 2000; ++i) {
+    int key = static_cast<int>(gen() % 5000);
+    tree.insert(key);
+    expected.insert(key);
+  }
+  auto it = tree.begin();
+  for (int key : expected) {
+    ASSERT_EQ(*it, key);
+    ++it;
+  }
+  ASSERT_EQ(it, tree.end());
+  for (auto rit = expected.rbegin(); rit != expected.rend(); ++rit) {
+    --it;
+    ASSERT_EQ(*it, *rit);
+  }
+  ASSERT_EQ(it, tree.begin());
+
+  IntTree::const_iterator cit = tree.find(*expected.rbegin());
+  EXPECT_EQ(++cit, tree.cend());
+  cit = tree.begin();
+  EXPECT_EQ(cit, tree.cbegin());
+}
+
+static bool SameShape(const IntTree::NodeBase* lhs,
+                      const IntTree::NodeBase* rhs) {
+  if (!lhs || !rhs) {
+    return lhs == rhs;
+  }
+  return static_cast<const IntTree::TreeNode*>(lhs)->key_ ==
+             static_cast<const IntTree::TreeNode*>(rhs)->key_ &&
+         lhs->colour() == rhs->colour() && SameShape(lhs->left_, rhs->left_) &&
+         SameShape(lhs->right_, rhs->right_);
+}
+
+TEST(RedBlackTreeTest, CopyKeepsShapeTest) {
+  std::mt19937 gen(23);
+  IntTree tree;
+  for (int i = 0; i < 5000; ++i) {
+    tree.insert(static_cast<int>(gen() % 20000));
+  }
+  IntTree copy(tree);
+  EXPECT_TRUE(SameShape(tree.root().base(), copy.root().base()));
+  EXPECT_GT(CheckedBlackHeight(copy), 0);
+  EXPECT_TRUE(std::equal(tree.begin(), tree.end(), copy.begin()));
+  EXPECT_EQ(*copy.max(), *tree.max());
+
+  IntTree single{7};
+  copy = single;
+  EXPECT_EQ(copy.size(), 1u);
+  EXPECT_EQ(*copy.begin(), 7);
+  copy = IntTree();
+  EXPECT_TRUE(copy.empty());
+}
+
+// Counts live keys and throws from the copy constructor once armed.
+struct FragileKey {
+  static int live;
+  static int copies_left;
+
+  explicit FragileKey(int v) : value(v) { ++live; }
+  FragileKey(const FragileKey& other) : value(other.value) {
+    if (copies_left-- == 0) {
+      throw std::runtime_error("copy failed");
+    }
+    ++live;
+  }
+  ~FragileKey() { --live; }
+
+  bool operator<(const FragileKey& other) const { return value < other.value; }
+
+  int value;
+};
+
+int FragileKey::live = 0;
+int FragileKey::copies_left = -1;
+
+TEST(RedBlackTreeTest, CopyThrowsCleanlyTest) {
+  using FragileTree =
+      s21::RedBlackTree<FragileKey, char, std::less<FragileKey>,
+                        std::allocator<std::pair<const FragileKey, char>>>;
+  {
+    FragileTree tree;
+    for (int i = 0; i < 100; ++i) {
+      tree.try_emplace(FragileKey(i));
+    }
+    int live = FragileKey::live;
+    FragileKey::copies_left = 60;
+    EXPECT_THROW(FragileTree copy(tree), std::runtime_error);
+    EXPECT_EQ(FragileKey::live, live);
+
+    FragileTree target;
+    target.try_emplace(FragileKey(-1));
+    FragileKey::copies_left = 30;
+    EXPECT_THROW(target = tree, std::runtime_error);
+    EXPECT_TRUE(target.empty());
+    EXPECT_EQ(FragileKey::live, live);
+    FragileKey::copies_left = -1;
+  }
+  EXPECT_EQ(FragileKey::live, 0);
+}
+
+TEST(RedBlackTreeTest, TearDownLargeTreeTest) {
+  using HeapTree =
+      s21::RedBlackTree<int, char, std::less<int>,
+                        std::allocator<std::pair<const int, char>>>;
+  HeapTree tree;
+  for (int i = 0; i < 100000; ++i) {
+    tree.insert(i);
+  }
+  HeapTree copy(tree);
+  tree.clear();
+  EXPECT_TRUE(tree.empty());
+  EXPECT_EQ(tree.begin(), tree.end());
+  EXPECT_EQ(copy.size(), 100000u);
+  EXPECT_EQ(*copy.max(), 99999);
+}
+
+using CountedTree =
+    s21::RedBlackTree<int, char, std::less<int>,
+                      std::allocator<std::pair<const int, char>>, true>;
+
+// Returns the size of the subtree, or -1 when a node counts it wrong.
+static long CheckedCount(const CountedTree::NodeBase* node) {
+  if (!node) {
+    return 0;
+  }
+  long left = CheckedCount(node->left_);
+  long right = CheckedCount(node->right_);
+  if (left < 0 || right < 0 ||
+      node->count_ != static_cast<size_t>(left + right + 1)) {
+    return -1;
+  }
+  return left + right + 1;
+}
+
+// nth(), rank() and distance() against the positions in a std::set.
+static void ExpectSameOrder(CountedTree& tree, const std::set<int>& expected) {
+  ASSERT_EQ(tree.size(), expected.size());
+  if (!tree.empty()) {
+    EXPECT_EQ(CheckedCount(tree.root().base()),
+              static_cast<long>(expected.size()));
+  }
+  size_t pos = 0;
+  for (int key : expected) {
+    ASSERT_NE(tree.nth(pos), tree.end());
+    EXPECT_EQ(*tree.nth(pos), key);
+    EXPECT_EQ(tree.rank(key), pos);
+    EXPECT_EQ(tree.distance(tree.cbegin(), tree.find(key)),
+              static_cast<std::ptrdiff_t>(pos));
+    ++pos;
+  }
+  EXPECT_EQ(tree.nth(pos), tree.end());
+  EXPECT_EQ(tree.rank(1000), expected.size());
+  EXPECT_EQ(tree.distance(tree.cbegin(), tree.cend()),
+            static_cast<std::ptrdiff_t>(expected.size()));
+  EXPECT_EQ(tree.distance(tree.cend(), tree.cbegin()),
+            -static_cast<std::ptrdiff_t>(expected.size()));
+}
+
+TEST(RedBlackTreeTest, OrderStatisticsFollowChangesTest) {
+  std::mt19937 gen(31);
+  CountedTree tree;
+  std::set<int> expected;
+  for (int step = 0; step < 2000; ++step) {
+    int key = static_cast<int>(gen() % 300);
+    switch (gen() % 4) {
+      case 0:
+      case 1:
+        tree.insert(key);
+        expected.insert(key);
+        break;
+      case 2:
+        EXPECT_EQ(tree.erase(key), expected.erase(key));
+        break;
+      default:
+        tree.insert(tree.lower_bound(key), key);
+        expected.insert(key);
+    }
+    if (step % 20 == 0) {
+      ExpectSameOrder(tree, expected);
+    }
+  }
+  ExpectSameOrder(tree, expected);
+  // a missing key ranks where it would be inserted
+  EXPECT_EQ(tree.rank(-5), 0u);
+  for (int key = 0; key < 300; ++key) {
+    auto bound = expected.lower_bound(key);
+    EXPECT_EQ(tree.rank(key), static_cast<size_t>(std::distance(
+                                  expected.begin(), bound)));
+  }
+}
+
+TEST(RedBlackTreeTest, OrderStatisticsFollowWholeTreeChangesTest) {
+  CountedTree tree{5, 3, 8, 1};
+  CountedTree copy(tree);
+  copy.insert(4);
+  ExpectSameOrder(copy, {1, 3, 4, 5, 8});
+  ExpectSameOrder(tree, {1, 3, 5, 8});
+
+  std::vector<int> sorted = {0, 2, 6, 7, 9};
+  CountedTree built = CountedTree::from_sorted(sorted.begin(), sorted.end());
+  ExpectSameOrder(built, {0, 2, 6, 7, 9});
+  built.merge(copy);
+  ExpectSameOrder(built, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+  ExpectSameOrder(copy, {});
+  CountedTree small{-1, 5};
+  built.merge(small);
+  ExpectSameOrder(built, {-1, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+  ExpectSameOrder(small, {5});
+
+  built.swap(tree);
+  ExpectSameOrder(tree, {-1, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+  ExpectSameOrder(built, {1, 3, 5, 8});
+  CountedTree moved(std::move(tree));
+  ExpectSameOrder(moved, {-1, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+  while (!moved.empty()) {
+    moved.erase(moved.nth(moved.size() / 2));
+  }
+  ExpectSameOrder(moved, {});
+}
+
+// The plain tree does not pay for the counts.
+TEST(RedBlackTreeTest, OrderStatisticsNodeSizeTest) {
+  EXPECT_EQ(sizeof(CountedTree::NodeBase),
+            sizeof(IntTree::NodeBase) + sizeof(size_t));
+  EXPECT_EQ(sizeof(IntTree::NodeBase), 3 * sizeof(void*));
+}
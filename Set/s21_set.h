@@ -4,19 +4,38 @@
 #include "../RedBlackTree/rb_tree.h"
 
 namespace s21 {
-template <typename Key>
-class Set : public RedBlackTree<Key> {
+// With OrderStatistics the set also answers nth(), rank() and distance()
+// in O(log n), see IndexedSet.
+template <typename Key, typename Compare = std::less<Key>,
+          typename Allocator = NodePool<Key>, bool OrderStatistics = false>
+class Set
+    : public RedBlackTree<Key, KeyOnly, Compare, Allocator, OrderStatistics> {
  public:
-  using Base = RedBlackTree<Key>;
+  using Base = RedBlackTree<Key, KeyOnly, Compare, Allocator, OrderStatistics>;
   using value_type = Key;
+  using allocator_type = Allocator;
 
   // Inherit constructor from the base class
   using Base::RedBlackTree;
 
   Set(std::initializer_list<value_type> const& items) : Base(items) {}
 
+  // Builds the set from keys sorted in ascending order in O(n).
+  template <typename InputIt>
+  static Set from_sorted(InputIt first, InputIt last) {
+    Set res;
+    res.assign_sorted(first, last);
+    return res;
+  }
+
+  // Builds the key first: Set elements have no mapped part to construct.
+  template <typename... Args>
+  std::pair<typename Base::iterator, bool> emplace(Args&&... args) {
+    return Base::try_emplace(Key(std::forward<Args>(args)...));
+  }
+
   // pretty printout
-  friend std::ostream& operator<<(std::ostream& os, const Set<Key>& set) {
+  friend std::ostream& operator<<(std::ostream& os, const Set& set) {
     if (set.size()) {
       auto it = set.cbegin();
       os << "Set is: {";
@@ -33,6 +52,12 @@ class Set : public RedBlackTree<Key> {
     return os;
   }
 };
+
+// A set whose nodes count their subtrees: percentiles and positions of keys
+// come from nth() and rank() instead of a walk from begin().
+template <typename Key, typename Compare = std::less<Key>,
+          typename Allocator = NodePool<Key>>
+using IndexedSet = Set<Key, Compare, Allocator, true>;
 }  // namespace s21
 
 #endif  // S21_SET_H
@@ -2,8 +2,12 @@
 
 #include <gtest/gtest.h>
 
+#include <cstdint>
+#include <iterator>
 #include <set>
 #include <string>
+#include <string_view>
+#include <vector>
 
 TEST(SetConstructorTest, EmptySet) {
   s21::Set<int> mySet;
@@ -261,10 +265,11 @@ TEST(SetCapacityTest, SizeAfterErase) {
   EXPECT_EQ(mySet.size(), 2u);
 }
 
+// A node of the set is smaller than one of std::set, so it can hold more.
 TEST(SetCapacityTest, MaxSize) {
   s21::Set<int> mySet;
   std::set<int> std_set;
-  EXPECT_EQ(mySet.max_size(), std_set.max_size());
+  EXPECT_GE(mySet.max_size(), std_set.max_size());
 }
 
 // Test case to check if clear() empties the set for integer elements
@@ -782,3 +787,116 @@ TEST(SetComparisonTest, Insert2) {
   EXPECT_EQ(mySet.size(), stdSet.size());
   EXPECT_TRUE(std::equal(mySet.begin(), mySet.end(), stdSet.begin()));
 }
+
+TEST(SetComparisonTest, Emplace) {
+  s21::Set<std::string> mySet;
+  std::set<std::string> stdSet;
+
+  auto res = mySet.emplace(3, 'a');
+  auto std_res = stdSet.emplace(3, 'a');
+  EXPECT_EQ(res.second, std_res.second);
+  EXPECT_EQ(*res.first, *std_res.first);
+
+  res = mySet.emplace("aaa");
+  std_res = stdSet.emplace("aaa");
+  EXPECT_EQ(res.second, std_res.second);
+  EXPECT_EQ(*res.first, *std_res.first);
+  EXPECT_EQ(mySet.size(), stdSet.size());
+}
+
+TEST(SetComparisonTest, FromSorted) {
+  std::vector<int> keys{1, 2, 2, 3, 5, 8, 13};
+  auto mySet = s21::Set<int>::from_sorted(keys.begin(), keys.end());
+  std::set<int> stdSet(keys.begin(), keys.end());
+
+  EXPECT_EQ(mySet.size(), stdSet.size());
+  EXPECT_TRUE(std::equal(mySet.begin(), mySet.end(), stdSet.begin()));
+}
+
+TEST(SetModifiersTest, MergeKeepsDuplicates) {
+  s21::Set<int> mySet = {1, 2, 3};
+  s21::Set<int> myOther = {3, 4, 5};
+  std::set<int> stdSet = {1, 2, 3};
+  std::set<int> stdOther = {3, 4, 5};
+
+  mySet.merge(myOther);
+  stdSet.merge(stdOther);
+
+  EXPECT_TRUE(std::equal(mySet.begin(), mySet.end(), stdSet.begin()));
+  EXPECT_EQ(myOther.size(), stdOther.size());
+  EXPECT_TRUE(std::equal(myOther.begin(), myOther.end(), stdOther.begin()));
+  myOther.insert(6);
+  EXPECT_EQ(myOther.size(), 2u);
+}
+
+TEST(SetEmplaceTest, InsertMovesKey) {
+  s21::Set<std::string> mySet;
+  std::string key(50, 'k');
+  ASSERT_TRUE(mySet.insert(std::move(key)).second);
+  ASSERT_TRUE(key.empty());
+  ASSERT_TRUE(mySet.contains(std::string(50, 'k')));
+}
+
+TEST(SetLookupTest, BoundsAndHeterogeneousKeys) {
+  s21::Set<std::string, std::less<>> mySet = {"b", "d", "f"};
+  std::set<std::string, std::less<>> stdSet = {"b", "d", "f"};
+  for (std::string_view key : {"a", "b", "c", "f", "g"}) {
+    auto it = mySet.lower_bound(key);
+    auto expected = stdSet.lower_bound(key);
+    if (expected == stdSet.end()) {
+      EXPECT_EQ(it, mySet.end());
+    } else {
+      EXPECT_EQ(*it, *expected);
+    }
+    EXPECT_EQ(mySet.count(key), stdSet.count(key));
+    EXPECT_EQ(mySet.contains(key), stdSet.count(key) == 1);
+  }
+  EXPECT_EQ(*mySet.upper_bound(std::string_view("b")), "d");
+  EXPECT_EQ(mySet.erase(std::string_view("d")), 1u);
+  EXPECT_EQ(mySet.find(std::string_view("d")), mySet.end());
+}
+
+TEST(SetLookupTest, CustomComparator) {
+  auto by_length = [](const std::string& lhs, const std::string& rhs) {
+    return lhs.size() < rhs.size();
+  };
+  s21::Set<std::string, decltype(by_length)> mySet(by_length);
+  mySet.insert("ccc");
+  mySet.insert("a");
+  EXPECT_FALSE(mySet.insert("b").second);
+  mySet.insert("bb");
+  std::vector<std::string> expected = {"a", "bb", "ccc"};
+  EXPECT_TRUE(std::equal(expected.begin(), expected.end(), mySet.begin()));
+  EXPECT_TRUE(mySet.contains("zz"));
+}
+
+TEST(SetOrderStatisticsTest, PercentilesAndRanks) {
+  s21::IndexedSet<std::uint64_t> mySet;
+  std::set<std::uint64_t> stdSet;
+  for (std::uint64_t i = 0; i < 1000; ++i) {
+    std::uint64_t key = i * 7919 % 1000 * 10;
+    mySet.insert(key);
+    stdSet.insert(key);
+  }
+  for (std::uint64_t key = 0; key < 10000; key += 20) {
+    mySet.erase(key);
+    stdSet.erase(key);
+  }
+  ASSERT_EQ(mySet.size(), stdSet.size());
+  for (int percent : {0, 10, 50, 90, 99}) {
+    size_t pos = stdSet.size() * percent / 100;
+    EXPECT_EQ(*mySet.nth(pos), *std::next(stdSet.begin(), pos));
+  }
+  EXPECT_EQ(mySet.nth(mySet.size()), mySet.end());
+  for (std::uint64_t key : {0u, 5u, 10u, 4990u, 9990u, 10000u}) {
+    EXPECT_EQ(mySet.rank(key),
+              static_cast<size_t>(std::distance(stdSet.begin(),
+                                                stdSet.lower_bound(key))));
+  }
+  auto first = mySet.find(110);
+  auto last = mySet.find(9970);
+  EXPECT_EQ(mySet.distance(first, last),
+            std::distance(stdSet.find(110), stdSet.find(9970)));
+  EXPECT_EQ(mySet.distance(last, first),
+            -std::distance(stdSet.find(110), stdSet.find(9970)));
+}
@@ -0,0 +1,389 @@
+#ifndef S21_SMALL_VECTOR_H
+#define S21_SMALL_VECTOR_H
+
+#include <algorithm>
+#include <cstring>
+#include <initializer_list>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../Vector/s21_growth_policy.h"
+#include "../Vector/s21_vector.h"
+
+namespace s21 {
+
+// A Vector that keeps up to N elements inside the object and only goes to
+// the heap once it grows beyond that, so short vectors never allocate. The
+// price is a bigger object, and moving or swapping inline elements one by
+// one instead of stealing a pointer. The capacity never drops below N.
+template <typename T, size_t N, typename GrowthPolicy = DoublingGrowth<N>>
+class SmallVector {
+  static_assert(N > 0, "Use Vector when nothing is stored inline");
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+  using iterator = T *;
+  using const_iterator = const T *;
+  using Allocator = std::allocator<T>;
+  using growth_policy = GrowthPolicy;
+
+  static constexpr size_type inline_capacity = N;
+
+  // CONSTRUCTORS
+  SmallVector() noexcept : data_(Inline()), size_(0), capacity_(N) {}
+
+  explicit SmallVector(size_type n, const_reference value = value_type())
+      : SmallVector() {
+    assign(n, value);
+  }
+
+  SmallVector(std::initializer_list<value_type> list) : SmallVector() {
+    Append(list.begin(), list.size());
+  }
+
+  SmallVector(const SmallVector &other) : SmallVector() {
+    Append(other.data_, other.size_);
+  }
+
+  SmallVector(SmallVector &&other) noexcept(
+      std::is_nothrow_move_constructible_v<value_type>)
+      : SmallVector() {
+    TakeFrom(other);
+  }
+
+  ~SmallVector() {
+    Destroy();
+    FreeHeap();
+  }
+
+  // ASSIGNEMENT OPERATORS
+  SmallVector &operator=(const SmallVector &other) {
+    if (&other != this) {
+      clear();
+      Append(other.data_, other.size_);
+    }
+    return *this;
+  }
+
+  SmallVector &operator=(SmallVector &&other) noexcept(
+      std::is_nothrow_move_constructible_v<value_type>) {
+    if (&other != this) {
+      clear();
+      TakeFrom(other);
+    }
+    return *this;
+  }
+
+  // Replaces the contents with count copies of value
+  void assign(size_type count, const_reference value) {
+    if (count > capacity_) {
+      value_type *new_data = alloc_.allocate(count);
+      try {
+        std::uninitialized_fill_n(new_data, count, value);
+      } catch (...) {
+        alloc_.deallocate(new_data, count);
+        throw;
+      }
+      Destroy();
+      FreeHeap();
+      data_ = new_data;
+      capacity_ = count;
+    } else if (count <= size_) {
+      std::fill_n(data_, count, value);
+      std::destroy(data_ + count, end());
+    } else {
+      std::fill_n(data_, size_, value);
+      std::uninitialized_fill_n(end(), count - size_, value);
+    }
+    size_ = count;
+  }
+
+  value_type *data() noexcept { return data_; }
+  const value_type *data() const noexcept { return data_; }
+
+  reference operator[](size_type i) { return at(i); }
+  const_reference operator[](size_type i) const { return at(i); }
+
+  reference at(size_type pos) {
+    if (pos >= size_) {
+      throw std::out_of_range("Position out of range");
+    }
+    return data_[pos];
+  }
+
+  const_reference at(size_type pos) const {
+    if (pos >= size_) {
+      throw std::out_of_range("Position out of range");
+    }
+    return data_[pos];
+  }
+
+  reference front() { return *data_; }
+  reference back() { return data_[size_ - 1]; }
+  const_reference front() const { return *data_; }
+  const_reference back() const { return data_[size_ - 1]; }
+
+  // CAPACITY
+  bool empty() const noexcept { return !size_; }
+  size_type size() const noexcept { return size_; }
+  size_type max_size() const noexcept {
+    return std::allocator_traits<Allocator>::max_size(alloc_);
+  }
+  size_type capacity() const noexcept { return capacity_; }
+
+  // True while the elements live inside the object.
+  bool is_inline() const noexcept { return data_ == Inline(); }
+
+  void reserve(size_type new_cap) {
+    if (new_cap > capacity_) {
+      Reallocate(new_cap);
+    }
+  }
+
+  // Moves the elements back inside the object when they fit there.
+  void shrink_to_fit() {
+    if (!is_inline() && size_ != capacity_) {
+      Reallocate(size_);
+    }
+  }
+
+  // MODIFIERS
+  void clear() noexcept {
+    Destroy();
+    size_ = 0;
+  }
+
+  iterator insert(const_iterator pos, const T &value) {
+    return emplace(pos, value);
+  }
+
+  iterator insert(const_iterator pos, T &&value) {
+    return emplace(pos, std::move(value));
+  }
+
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args &&...args) {
+    if (pos > cend() || pos < cbegin())
+      throw std::out_of_range("Position out of range");
+    size_type ind = pos - cbegin();
+    if (ind == size_) {
+      emplace_back(std::forward<Args>(args)...);
+      return data_ + ind;
+    }
+    value_type value(std::forward<Args>(args)...);
+    if (size_ == capacity_) {
+      Reallocate(NextCapacity(size_ + 1));
+    }
+    iterator it = data_ + ind;
+    std::allocator_traits<Allocator>::construct(alloc_, end(),
+                                                std::move(back()));
+    std::move_backward(it, end() - 1, end());
+    *it = std::move(value);
+    ++size_;
+    return it;
+  }
+
+  iterator erase(const_iterator pos) {
+    if (pos >= cend() || pos < cbegin())
+      throw std::out_of_range("Position out of range");
+    iterator it = data_ + (pos - cbegin());
+    std::move(it + 1, end(), it);
+    pop_back();
+    return it;
+  }
+
+  void push_back(const_reference value) { emplace_back(value); }
+  void push_back(T &&value) { emplace_back(std::move(value)); }
+
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    if (size_ == capacity_) {
+      GrowAndEmplaceBack(std::forward<Args>(args)...);
+    } else {
+      std::allocator_traits<Allocator>::construct(alloc_, end(),
+                                                  std::forward<Args>(args)...);
+    }
+    ++size_;
+    return back();
+  }
+
+  void pop_back() {
+    if (size_) {
+      std::allocator_traits<Allocator>::destroy(alloc_, end() - 1);
+      --size_;
+    }
+  }
+
+  void resize(size_type count, const_reference value = value_type()) {
+    if (count < size_) {
+      std::destroy(data_ + count, end());
+      size_ = count;
+    } else if (count > size_) {
+      if (count > capacity_) {
+        // value may refer to an element, which moves with the buffer
+        value_type copy(value);
+        Reallocate(NextCapacity(count));
+        std::uninitialized_fill_n(end(), count - size_, copy);
+      } else {
+        std::uninitialized_fill_n(end(), count - size_, value);
+      }
+      size_ = count;
+    }
+  }
+
+  // Two heap buffers trade pointers; inline elements have to be moved.
+  void swap(SmallVector &other) noexcept(
+      std::is_nothrow_move_constructible_v<value_type>) {
+    if (!is_inline() && !other.is_inline()) {
+      std::swap(data_, other.data_);
+      std::swap(size_, other.size_);
+      std::swap(capacity_, other.capacity_);
+    } else if (&other != this) {
+      SmallVector tmp(std::move(other));
+      other = std::move(*this);
+      *this = std::move(tmp);
+    }
+  }
+
+  // ITERATORS
+  iterator begin() noexcept { return data_; }
+  iterator end() noexcept { return data_ + size_; }
+  const_iterator begin() const noexcept { return data_; }
+  const_iterator end() const noexcept { return data_ + size_; }
+  const_iterator cbegin() const noexcept { return data_; }
+  const_iterator cend() const noexcept { return data_ + size_; }
+
+ private:
+  std::allocator<value_type> alloc_;
+  value_type *data_;
+  size_type size_;
+  size_type capacity_;
+  alignas(value_type) unsigned char storage_[N * sizeof(value_type)];
+
+  value_type *Inline() noexcept {
+    return reinterpret_cast<value_type *>(storage_);
+  }
+  const value_type *Inline() const noexcept {
+    return reinterpret_cast<const value_type *>(storage_);
+  }
+
+  size_type NextCapacity(size_type required) const {
+    return GrowthPolicy::Grow(capacity_, required, sizeof(value_type));
+  }
+
+  void Destroy() noexcept { std::destroy_n(data_, size_); }
+
+  void FreeHeap() noexcept {
+    if (!is_inline()) {
+      alloc_.deallocate(data_, capacity_);
+    }
+  }
+
+  // Copies count elements from src to the end, which must not alias this
+  // vector.
+  void Append(const value_type *src, size_type count) {
+    if (count > capacity_ - size_) {
+      Reallocate(size_ + count);
+    }
+    std::uninitialized_copy_n(src, count, end());
+    size_ += count;
+  }
+
+  // Takes the elements of other into this empty vector: a heap buffer is
+  // stolen, inline elements are moved over one by one. other ends up empty.
+  void TakeFrom(SmallVector &other) {
+    if (!other.is_inline()) {
+      FreeHeap();
+      data_ = other.data_;
+      size_ = other.size_;
+      capacity_ = other.capacity_;
+      other.data_ = other.Inline();
+      other.size_ = 0;
+      other.capacity_ = N;
+    } else {
+      std::uninitialized_move_n(other.data_, other.size_, data_);
+      size_ = other.size_;
+      other.clear();
+    }
+  }
+
+  // Moves the elements into a buffer of new_cap elements, which is the
+  // inline one when they fit there.
+  void Reallocate(size_type new_cap) {
+    value_type *new_data = Inline();
+    if (new_cap > N) {
+      new_data = alloc_.allocate(new_cap);
+    } else {
+      new_cap = N;
+    }
+    try {
+      Relocate(new_data);
+    } catch (...) {
+      if (new_data != Inline()) {
+        alloc_.deallocate(new_data, new_cap);
+      }
+      throw;
+    }
+    Release();
+    data_ = new_data;
+    capacity_ = new_cap;
+  }
+
+  // Grows to the heap and constructs the new last element from args before
+  // the old elements move, as args may refer to one of them.
+  template <typename... Args>
+  void GrowAndEmplaceBack(Args &&...args) {
+    size_type new_cap = NextCapacity(size_ + 1);
+    value_type *new_data = alloc_.allocate(new_cap);
+    try {
+      std::allocator_traits<Allocator>::construct(
+          alloc_, new_data + size_, std::forward<Args>(args)...);
+    } catch (...) {
+      alloc_.deallocate(new_data, new_cap);
+      throw;
+    }
+    try {
+      Relocate(new_data);
+    } catch (...) {
+      std::allocator_traits<Allocator>::destroy(alloc_, new_data + size_);
+      alloc_.deallocate(new_data, new_cap);
+      throw;
+    }
+    Release();
+    data_ = new_data;
+    capacity_ = new_cap;
+  }
+
+  // Transfers the elements into new_data the way Vector does.
+  void Relocate(value_type *new_data) {
+    if constexpr (is_trivially_relocatable_v<value_type>) {
+      if (size_) {
+        std::memcpy(static_cast<void *>(new_data),
+                    static_cast<const void *>(data_),
+                    size_ * sizeof(value_type));
+      }
+    } else if constexpr (std::is_nothrow_move_constructible_v<value_type> ||
+                         !std::is_copy_constructible_v<value_type>) {
+      std::uninitialized_move_n(data_, size_, new_data);
+    } else {
+      std::uninitialized_copy_n(data_, size_, new_data);
+    }
+  }
+
+  // Drops the old buffer once Relocate has succeeded.
+  void Release() noexcept {
+    if constexpr (!is_trivially_relocatable_v<value_type>) {
+      Destroy();
+    }
+    FreeHeap();
+  }
+};
+
+}  // namespace s21
+
+#endif  // S21_SMALL_VECTOR_H
@@ -0,0 +1,281 @@
+#include "s21_small_vector.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+using SmallInts = s21::SmallVector<int, 4>;
+using SmallStrings = s21::SmallVector<std::string, 4>;
+
+// A string long enough to live on the heap, so a missed destructor or a
+// bytewise copy of an inline element shows up under the sanitizers.
+std::string Long(int i) { return std::string(40, 'a' + i % 26) + "!"; }
+
+template <typename Small, typename T>
+void ExpectEqual(const Small &small, const std::vector<T> &expected) {
+  ASSERT_EQ(small.size(), expected.size());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_EQ(small[i], expected[i]);
+  }
+}
+
+}  // namespace
+
+TEST(TestSmallVectorConstructor, DefaultIsInline) {
+  SmallInts v;
+  EXPECT_TRUE(v.empty());
+  EXPECT_TRUE(v.is_inline());
+  EXPECT_EQ(v.capacity(), 4U);
+  EXPECT_EQ(v.size(), 0U);
+}
+
+TEST(TestSmallVectorConstructor, DataLivesInsideTheObject) {
+  SmallInts v = {1, 2, 3};
+  auto object = reinterpret_cast<const char *>(&v);
+  auto data = reinterpret_cast<const char *>(v.data());
+  EXPECT_GE(data, object);
+  EXPECT_LT(data, object + sizeof(v));
+  ExpectEqual(v, std::vector<int>{1, 2, 3});
+}
+
+TEST(TestSmallVectorConstructor, InitializerListSpills) {
+  SmallInts v = {1, 2, 3, 4, 5, 6};
+  EXPECT_FALSE(v.is_inline());
+  EXPECT_EQ(v.capacity(), 6U);
+  ExpectEqual(v, std::vector<int>{1, 2, 3, 4, 5, 6});
+}
+
+TEST(TestSmallVectorConstructor, CountAndValue) {
+  SmallStrings inline_v(3, Long(1));
+  SmallStrings heap_v(7, Long(2));
+  EXPECT_TRUE(inline_v.is_inline());
+  EXPECT_FALSE(heap_v.is_inline());
+  ExpectEqual(inline_v, std::vector<std::string>(3, Long(1)));
+  ExpectEqual(heap_v, std::vector<std::string>(7, Long(2)));
+}
+
+TEST(TestSmallVectorConstructor, CopyInline) {
+  SmallStrings v = {Long(1), Long(2)};
+  SmallStrings copy(v);
+  EXPECT_TRUE(copy.is_inline());
+  ExpectEqual(copy, std::vector<std::string>{Long(1), Long(2)});
+  ExpectEqual(v, std::vector<std::string>{Long(1), Long(2)});
+}
+
+TEST(TestSmallVectorConstructor, CopyHeap) {
+  SmallStrings v = {Long(1), Long(2), Long(3), Long(4), Long(5)};
+  SmallStrings copy(v);
+  EXPECT_FALSE(copy.is_inline());
+  EXPECT_NE(copy.data(), v.data());
+  ExpectEqual(copy, std::vector<std::string>(v.begin(), v.end()));
+}
+
+TEST(TestSmallVectorConstructor, MoveInlineMovesElements) {
+  SmallStrings v = {Long(1), Long(2), Long(3)};
+  SmallStrings moved(std::move(v));
+  EXPECT_TRUE(moved.is_inline());
+  ExpectEqual(moved, std::vector<std::string>{Long(1), Long(2), Long(3)});
+  EXPECT_TRUE(v.empty());
+  EXPECT_TRUE(v.is_inline());
+}
+
+TEST(TestSmallVectorConstructor, MoveHeapStealsBuffer) {
+  SmallStrings v = {Long(1), Long(2), Long(3), Long(4), Long(5)};
+  const std::string *buffer = v.data();
+  SmallStrings moved(std::move(v));
+  EXPECT_EQ(moved.data(), buffer);
+  EXPECT_EQ(moved.size(), 5U);
+  EXPECT_TRUE(v.empty());
+  EXPECT_TRUE(v.is_inline());
+  EXPECT_EQ(v.capacity(), 4U);
+  v.push_back(Long(6));
+  EXPECT_EQ(v.back(), Long(6));
+}
+
+TEST(TestSmallVectorConstructor, MoveOnly) {
+  s21::SmallVector<std::unique_ptr<int>, 2> v;
+  for (int i = 0; i < 5; ++i) {
+    v.emplace_back(std::make_unique<int>(i));
+  }
+  s21::SmallVector<std::unique_ptr<int>, 2> moved(std::move(v));
+  ASSERT_EQ(moved.size(), 5U);
+  for (int i = 0; i < 5; ++i) {
+    EXPECT_EQ(*moved[i], i);
+  }
+}
+
+TEST(TestSmallVectorAssignment, CopyBetweenModes) {
+  SmallStrings heap_v = {Long(1), Long(2), Long(3), Long(4), Long(5)};
+  SmallStrings inline_v = {Long(6)};
+  inline_v = heap_v;
+  ExpectEqual(inline_v, std::vector<std::string>(heap_v.begin(), heap_v.end()));
+  heap_v = SmallStrings{Long(7)};
+  ExpectEqual(heap_v, std::vector<std::string>{Long(7)});
+  heap_v = heap_v;
+  ExpectEqual(heap_v, std::vector<std::string>{Long(7)});
+}
+
+TEST(TestSmallVectorAssignment, MoveHeapIntoHeap) {
+  SmallStrings a = {Long(1), Long(2), Long(3), Long(4), Long(5)};
+  SmallStrings b = {Long(6), Long(7), Long(8), Long(9), Long(10)};
+  const std::string *buffer = a.data();
+  b = std::move(a);
+  EXPECT_EQ(b.data(), buffer);
+  EXPECT_EQ(b.front(), Long(1));
+  EXPECT_TRUE(a.empty());
+}
+
+TEST(TestSmallVectorAssignment, MoveInlineIntoHeap) {
+  SmallStrings a = {Long(1)};
+  SmallStrings b = {Long(6), Long(7), Long(8), Long(9), Long(10)};
+  b = std::move(a);
+  ExpectEqual(b, std::vector<std::string>{Long(1)});
+  EXPECT_TRUE(a.empty());
+}
+
+TEST(TestSmallVectorAssignment, Assign) {
+  SmallStrings v = {Long(1), Long(2)};
+  v.assign(3, Long(3));
+  EXPECT_TRUE(v.is_inline());
+  ExpectEqual(v, std::vector<std::string>(3, Long(3)));
+  v.assign(1, v[0]);
+  ExpectEqual(v, std::vector<std::string>(1, Long(3)));
+  v.assign(9, Long(4));
+  EXPECT_FALSE(v.is_inline());
+  ExpectEqual(v, std::vector<std::string>(9, Long(4)));
+}
+
+TEST(TestSmallVectorAccess, OutOfRange) {
+  SmallInts v = {1, 2};
+  EXPECT_THROW(v.at(2), std::out_of_range);
+  EXPECT_THROW(v[5], std::out_of_range);
+  const SmallInts &cv = v;
+  EXPECT_THROW(cv.at(2), std::out_of_range);
+  EXPECT_EQ(cv.front(), 1);
+  EXPECT_EQ(cv.back(), 2);
+}
+
+TEST(TestSmallVectorCapacity, PushBackSpillsAfterN) {
+  SmallInts v;
+  for (int i = 0; i < 4; ++i) {
+    v.push_back(i);
+    EXPECT_TRUE(v.is_inline());
+  }
+  v.push_back(4);
+  EXPECT_FALSE(v.is_inline());
+  EXPECT_EQ(v.capacity(), 8U);
+  ExpectEqual(v, std::vector<int>{0, 1, 2, 3, 4});
+}
+
+TEST(TestSmallVectorCapacity, PushBackOwnElementOnSpill) {
+  SmallStrings v = {Long(1), Long(2), Long(3), Long(4)};
+  v.push_back(v[0]);
+  v.emplace_back(v[1]);
+  ExpectEqual(v, std::vector<std::string>{Long(1), Long(2), Long(3), Long(4),
+                                          Long(1), Long(2)});
+}
+
+TEST(TestSmallVectorCapacity, ReserveAndShrinkBackInline) {
+  SmallStrings v = {Long(1), Long(2)};
+  v.reserve(3);
+  EXPECT_TRUE(v.is_inline());
+  v.reserve(10);
+  EXPECT_FALSE(v.is_inline());
+  EXPECT_EQ(v.capacity(), 10U);
+  v.shrink_to_fit();
+  EXPECT_TRUE(v.is_inline());
+  EXPECT_EQ(v.capacity(), 4U);
+  ExpectEqual(v, std::vector<std::string>{Long(1), Long(2)});
+  v.resize(6, Long(3));
+  v.shrink_to_fit();
+  EXPECT_EQ(v.capacity(), 6U);
+  EXPECT_FALSE(v.is_inline());
+}
+
+TEST(TestSmallVectorModifiers, InsertAndErase) {
+  SmallStrings v = {Long(1), Long(3)};
+  v.insert(v.cbegin() + 1, Long(2));
+  v.insert(v.cbegin(), Long(0));
+  v.insert(v.cend(), Long(4));
+  ExpectEqual(v, std::vector<std::string>{Long(0), Long(1), Long(2), Long(3),
+                                          Long(4)});
+  auto it = v.erase(v.cbegin() + 2);
+  EXPECT_EQ(*it, Long(3));
+  v.erase(v.cend() - 1);
+  ExpectEqual(v, std::vector<std::string>{Long(0), Long(1), Long(3)});
+  EXPECT_THROW(v.erase(v.cend()), std::out_of_range);
+  EXPECT_THROW(v.insert(v.cend() + 1, Long(5)), std::out_of_range);
+}
+
+TEST(TestSmallVectorModifiers, ResizeAcrossModes) {
+  SmallStrings v = {Long(1)};
+  v.resize(3, Long(2));
+  EXPECT_TRUE(v.is_inline());
+  v.resize(6, v[0]);
+  EXPECT_FALSE(v.is_inline());
+  ExpectEqual(v, std::vector<std::string>{Long(1), Long(2), Long(2), Long(1),
+                                          Long(1), Long(1)});
+  v.resize(1);
+  ExpectEqual(v, std::vector<std::string>{Long(1)});
+}
+
+TEST(TestSmallVectorModifiers, PopBackAndClear) {
+  SmallInts v = {1, 2, 3, 4, 5};
+  v.pop_back();
+  EXPECT_EQ(v.back(), 4);
+  v.clear();
+  EXPECT_TRUE(v.empty());
+  v.pop_back();
+  EXPECT_TRUE(v.empty());
+}
+
+TEST(TestSmallVectorModifiers, SwapAllModes) {
+  const std::vector<std::string> small = {Long(1), Long(2)};
+  const std::vector<std::string> big = {Long(3), Long(4), Long(5), Long(6),
+                                        Long(7)};
+  for (int mode = 0; mode < 4; ++mode) {
+    const auto &first = mode & 1 ? big : small;
+    const auto &second = mode & 2 ? big : small;
+    SmallStrings a, b;
+    for (const auto &s : first) a.push_back(s);
+    for (const auto &s : second) b.push_back(s);
+    a.swap(b);
+    ExpectEqual(a, second);
+    ExpectEqual(b, first);
+    a.swap(a);
+    ExpectEqual(a, second);
+  }
+}
+
+TEST(TestSmallVectorModifiers, MatchesStdVector) {
+  std::mt19937 gen(21);
+  s21::SmallVector<std::string, 3> v;
+  std::vector<std::string> expected;
+  for (int step = 0; step < 2000; ++step) {
+    int op = gen() % 6;
+    if (op < 2) {
+      v.push_back(Long(step));
+      expected.push_back(Long(step));
+    } else if (op == 2 && !expected.empty()) {
+      v.pop_back();
+      expected.pop_back();
+    } else if (op == 3) {
+      size_t pos = gen() % (expected.size() + 1);
+      v.insert(v.cbegin() + pos, Long(step));
+      expected.insert(expected.begin() + pos, Long(step));
+    } else if (op == 4 && !expected.empty()) {
+      size_t pos = gen() % expected.size();
+      v.erase(v.cbegin() + pos);
+      expected.erase(expected.begin() + pos);
+    } else if (op == 5) {
+      v.shrink_to_fit();
+    }
+    ASSERT_EQ(v.is_inline(), v.capacity() == 3U);
+  }
+  ExpectEqual(v, expected);
+}
@@ -3,13 +3,17 @@
 
 #include <initializer_list>
 #include <iostream>
+#include <stdexcept>
 
 #include "../List/s21_list.h"
 #include "../Vector/s21_vector.h"
 
 namespace s21 {
 
-template <typename T, typename Container = List<T>>
+// The top of the stack is the back of Container, which can be any sequence
+// with back(), push_back(), emplace_back() and pop_back(). The default is
+// the contiguous Vector; List works as well.
+template <typename T, typename Container = Vector<T>>
 class Stack {
  public:
   // Functions
@@ -26,6 +30,7 @@ class Stack {
   using reference = T &;
   using const_reference = const T &;
   using size_type = size_t;
+  using container_type = Container;
 
   // Element access
   const_reference top() const;
@@ -36,11 +41,14 @@ class Stack {
 
   // Modifiers
   void push(const_reference value);
+  void push(T &&value);
+  template <typename... Args>
+  reference emplace(Args &&...args);
   void pop();
   void swap(Stack &other);
 
  private:
-  Container List_;
+  Container container_;
 
 };  // class stack
 }  // namespace s21
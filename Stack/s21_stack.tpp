@@ -2,7 +2,7 @@
 
 namespace s21 {
 template <typename T, typename Container>
-Stack<T, Container>::Stack() : List_() {}
+Stack<T, Container>::Stack() : container_() {}
 
 template <typename T, typename Container>
 Stack<T, Container>::Stack(std::initializer_list<T> const& items) {
@@ -12,10 +12,11 @@ Stack<T, Container>::Stack(std::initializer_list<T> const& items) {
 }
 
 template <typename T, typename Container>
-Stack<T, Container>::Stack(const Stack& other) : List_(other.List_) {}
+Stack<T, Container>::Stack(const Stack& other) : container_(other.container_) {}
 
 template <typename T, typename Container>
-Stack<T, Container>::Stack(Stack&& other) : List_(std::move(other.List_)) {}
+Stack<T, Container>::Stack(Stack&& other)
+    : container_(std::move(other.container_)) {}
 
 template <typename T, typename Container>
 Stack<T, Container>::~Stack() {}
@@ -23,7 +24,7 @@ Stack<T, Container>::~Stack() {}
 template <typename T, typename Container>
 Stack<T, Container>& Stack<T, Container>::operator=(const Stack& other) {
   if (this != &other) {
-    List_ = other.List_;
+    container_ = other.container_;
   }
   return *this;
 }
@@ -31,51 +32,57 @@ Stack<T, Container>& Stack<T, Container>::operator=(const Stack& other) {
 template <typename T, typename Container>
 Stack<T, Container>& Stack<T, Container>::operator=(Stack&& other) noexcept {
   if (this != &other) {
-    List_ = std::move(other.List_);
+    container_ = std::move(other.container_);
   }
   return *this;
 }
 
 template <typename T, typename Container>
 typename Stack<T, Container>::const_reference Stack<T, Container>::top() const {
-  if constexpr (std::is_same_v<Container, s21::Vector<T>>) {
-    return List_.back();
-  } else {
-    return List_.front();
+  if (container_.empty()) {
+    throw std::out_of_range("Stack is empty");
   }
+  return container_.back();
 }
 
 template <typename T, typename Container>
 bool Stack<T, Container>::empty() const {
-  return List_.empty();
+  return container_.empty();
 }
 
 template <typename T, typename Container>
 typename Stack<T, Container>::size_type Stack<T, Container>::size() const {
-  return List_.size();
+  return container_.size();
 }
 
 template <typename T, typename Container>
 void Stack<T, Container>::push(const_reference value) {
-  if constexpr (std::is_same_v<Container, Vector<T>>) {
-    List_.push_back(value);
-  } else {
-    List_.push_front(value);
-  }
+  container_.push_back(value);
+}
+
+template <typename T, typename Container>
+void Stack<T, Container>::push(T&& value) {
+  container_.push_back(std::move(value));
+}
+
+template <typename T, typename Container>
+template <typename... Args>
+typename Stack<T, Container>::reference Stack<T, Container>::emplace(
+    Args&&... args) {
+  return container_.emplace_back(std::forward<Args>(args)...);
 }
 
 template <typename T, typename Container>
 void Stack<T, Container>::pop() {
-  if constexpr (std::is_same_v<Container, Vector<T>>) {
-    List_.pop_back();
-  } else {
-    List_.pop_front();
+  if (container_.empty()) {
+    throw std::out_of_range("Stack is empty");
   }
+  container_.pop_back();
 }
 
 template <typename T, typename Container>
 void Stack<T, Container>::swap(Stack& other) {
-  List_.swap(other.List_);
+  container_.swap(other.container_);
 }
 
 }  // namespace s21
\ No newline at end of file
@@ -2,8 +2,13 @@
 
 #include <gtest/gtest.h>
 
+#include <deque>
 #include <iostream>
+#include <memory>
 #include <stack>
+#include <string>
+#include <type_traits>
+#include <vector>
 
 TEST(TestConstructor, ConstructorDefault) {
   s21::Stack<size_t> s;
@@ -416,3 +421,80 @@ TEST(TestStackStringCopyAssignment, CopyAssignment) {
   EXPECT_EQ(stack.size(), original.size());
   EXPECT_EQ(stack.top(), original.top());
 }
+
+TEST(TestStackEmplace, MoveOnlyList) {
+  s21::Stack<std::unique_ptr<int>> stack;
+  stack.emplace(new int(1));
+  stack.push(std::make_unique<int>(2));
+  EXPECT_EQ(*stack.emplace(new int(3)), 3);
+  EXPECT_EQ(stack.size(), 3u);
+  EXPECT_EQ(*stack.top(), 3);
+  stack.pop();
+  EXPECT_EQ(*stack.top(), 2);
+}
+
+TEST(TestStackEmplace, MoveOnlyVector) {
+  s21::Stack<std::unique_ptr<int>, s21::Vector<std::unique_ptr<int>>> stack;
+  for (int i = 0; i < 10; ++i) {
+    stack.emplace(new int(i));
+  }
+  stack.push(std::make_unique<int>(10));
+  EXPECT_EQ(stack.size(), 11u);
+  EXPECT_EQ(*stack.top(), 10);
+  stack.pop();
+  EXPECT_EQ(*stack.top(), 9);
+}
+
+TEST(TestStackEmplace, PushMovesValue) {
+  s21::Stack<std::string> stack;
+  std::string value(50, 'a');
+  stack.push(std::move(value));
+  EXPECT_EQ(stack.top(), std::string(50, 'a'));
+  EXPECT_TRUE(value.empty());
+}
+
+TEST(TestStackContainer, DefaultsToVector) {
+  static_assert(std::is_same_v<s21::Stack<int>::container_type,
+                               s21::Vector<int>>);
+  s21::Stack<int> stack = {1, 2, 3};
+  EXPECT_EQ(stack.top(), 3);
+}
+
+template <typename Container>
+void CheckLifo() {
+  s21::Stack<int, Container> stack;
+  std::stack<int> expected;
+  for (int i = 0; i < 1000; ++i) {
+    stack.push(i);
+    expected.push(i);
+    if (i % 3 == 0) {
+      stack.pop();
+      expected.pop();
+    }
+  }
+  ASSERT_EQ(stack.size(), expected.size());
+  while (!expected.empty()) {
+    ASSERT_EQ(stack.top(), expected.top());
+    stack.pop();
+    expected.pop();
+  }
+  EXPECT_TRUE(stack.empty());
+}
+
+TEST(TestStackContainer, AnyBackInsertableContainer) {
+  CheckLifo<s21::Vector<int>>();
+  CheckLifo<s21::List<int>>();
+  CheckLifo<std::vector<int>>();
+  CheckLifo<std::deque<int>>();
+}
+
+TEST(TestStackContainer, EmptyStackThrows) {
+  s21::Stack<int> stack;
+  EXPECT_THROW(stack.top(), std::out_of_range);
+  EXPECT_THROW(stack.pop(), std::out_of_range);
+  stack.push(1);
+  stack.pop();
+  EXPECT_THROW(stack.pop(), std::out_of_range);
+  s21::Stack<int, s21::List<int>> list_stack;
+  EXPECT_THROW(list_stack.top(), std::out_of_range);
+}
@@ -0,0 +1,635 @@
+#ifndef S21_HASH_TABLE_H
+#define S21_HASH_TABLE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace s21 {
+
+// Open addressing hash table in the style of Abseil's Swiss tables, the
+// common base of UnorderedMap and UnorderedSet.
+//
+// Next to the slots there is one control byte per slot: empty, deleted, or
+// the 7 low bits of the hash (H2) of a full slot. The remaining bits (H1)
+// choose where probing starts. Probing walks groups of 16 control bytes,
+// which SSE2 compares against H2 all at once, so a lookup usually touches
+// one group of control bytes and then only the slots whose H2 matched.
+//
+// The capacity is always 2^k - 1. The control bytes are followed by a
+// sentinel, which stops iteration, and a copy of the first 15 bytes, so a
+// group can be loaded at any position without wrapping around.
+//
+// Erased slots become empty again unless a probe sequence may have passed
+// them on the way to a later slot, which is only possible when the group
+// around them has no empty byte; only then a deleted marker is left. The
+// markers are dropped at the next rehash, and a table mostly clogged with
+// them is rehashed in place instead of growing.
+template <typename Key, typename Slot, typename Hash, typename KeyEqual>
+class HashTable {
+ public:
+  using ctrl_t = signed char;
+
+ private:
+  static constexpr ctrl_t kEmpty = -128;
+  static constexpr ctrl_t kDeleted = -2;
+  static constexpr ctrl_t kSentinel = -1;
+
+  // The control bytes an empty table points to: a sentinel, so begin() is
+  // end(), followed by empty bytes, so lookups stop at the first group.
+  alignas(16) static constexpr ctrl_t kEmptyGroup[16] = {
+      kSentinel, kEmpty, kEmpty, kEmpty, kEmpty, kEmpty, kEmpty, kEmpty,
+      kEmpty,    kEmpty, kEmpty, kEmpty, kEmpty, kEmpty, kEmpty, kEmpty};
+
+  // 16 control bytes; every mask has bit i set when byte i qualifies.
+  class Group {
+   public:
+    static constexpr size_t kWidth = 16;
+
+#ifdef __SSE2__
+    explicit Group(const ctrl_t* pos)
+        : ctrl_(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pos))) {}
+
+    uint32_t Match(ctrl_t h2) const {
+      return _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl_));
+    }
+
+    uint32_t MaskEmpty() const { return Match(kEmpty); }
+
+    uint32_t MaskEmptyOrDeleted() const {
+      return _mm_movemask_epi8(
+          _mm_cmpgt_epi8(_mm_set1_epi8(kSentinel), ctrl_));
+    }
+
+   private:
+    __m128i ctrl_;
+#else
+    explicit Group(const ctrl_t* pos) { std::memcpy(ctrl_, pos, kWidth); }
+
+    uint32_t Match(ctrl_t h2) const {
+      uint32_t mask = 0;
+      for (size_t i = 0; i < kWidth; ++i) {
+        mask |= static_cast<uint32_t>(ctrl_[i] == h2) << i;
+      }
+      return mask;
+    }
+
+    uint32_t MaskEmpty() const { return Match(kEmpty); }
+
+    uint32_t MaskEmptyOrDeleted() const {
+      uint32_t mask = 0;
+      for (size_t i = 0; i < kWidth; ++i) {
+        mask |= static_cast<uint32_t>(ctrl_[i] < kSentinel) << i;
+      }
+      return mask;
+    }
+
+   private:
+    ctrl_t ctrl_[kWidth];
+#endif
+
+   public:
+    // The number of empty or deleted bytes before the first other one.
+    size_t CountLeadingEmptyOrDeleted() const {
+      return __builtin_ctz(MaskEmptyOrDeleted() + 1);
+    }
+  };
+
+  // Visits the groups starting at H1, stepping 16, 32, 48... bytes further
+  // each time. With a capacity of 2^k - 1 this reaches every slot.
+  class ProbeSeq {
+   public:
+    ProbeSeq(size_t hash, size_t mask) : mask_(mask), offset_(hash & mask) {}
+
+    size_t offset() const { return offset_; }
+    size_t offset(size_t i) const { return (offset_ + i) & mask_; }
+
+    void next() {
+      index_ += Group::kWidth;
+      offset_ = (offset_ + index_) & mask_;
+    }
+
+   private:
+    size_t mask_;
+    size_t offset_;
+    size_t index_ = 0;
+  };
+
+  template <bool Const>
+  class HashIterator;
+
+ public:
+  using key_type = Key;
+  using size_type = size_t;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using iterator = HashIterator<false>;
+  using const_iterator = HashIterator<true>;
+
+  // CONSTRUCTORS
+  HashTable() noexcept = default;
+
+  explicit HashTable(size_type bucket_count, const Hash& hash = Hash(),
+                     const KeyEqual& equal = KeyEqual())
+      : hash_(hash), equal_(equal) {
+    reserve(bucket_count);
+  }
+
+  HashTable(const HashTable& other)
+      : HashTable(0, other.hash_, other.equal_) {
+    max_load_factor_ = other.max_load_factor_;
+    reserve(other.size_);
+    for (auto it = other.cbegin(); it != other.cend(); ++it) {
+      size_type i = PrepareInsert(Mix(hash_(it.key())));
+      try {
+        slot_traits::construct(slot_alloc_, slots_ + i, *it.slot());
+      } catch (...) {
+        EraseCtrl(i);
+        throw;
+      }
+    }
+  }
+
+  HashTable(HashTable&& other) noexcept
+      : ctrl_(other.ctrl_),
+        slots_(other.slots_),
+        capacity_(other.capacity_),
+        size_(other.size_),
+        growth_left_(other.growth_left_),
+        hash_(std::move(other.hash_)),
+        equal_(std::move(other.equal_)),
+        max_load_factor_(other.max_load_factor_) {
+    other.Reset();
+  }
+
+  ~HashTable() { Free(); }
+
+  HashTable& operator=(const HashTable& other) {
+    if (this != &other) {
+      HashTable copy(other);
+      swap(copy);
+    }
+    return *this;
+  }
+
+  HashTable& operator=(HashTable&& other) noexcept {
+    if (this != &other) {
+      Free();
+      ctrl_ = other.ctrl_;
+      slots_ = other.slots_;
+      capacity_ = other.capacity_;
+      size_ = other.size_;
+      growth_left_ = other.growth_left_;
+      hash_ = std::move(other.hash_);
+      equal_ = std::move(other.equal_);
+      max_load_factor_ = other.max_load_factor_;
+      other.Reset();
+    }
+    return *this;
+  }
+
+  // ITERATORS
+  iterator begin() noexcept {
+    iterator it(ctrl_, slots_);
+    it.SkipEmptyOrDeleted();
+    return it;
+  }
+  iterator end() noexcept {
+    return iterator(ctrl_ + capacity_, slots_ + capacity_);
+  }
+  const_iterator begin() const noexcept { return cbegin(); }
+  const_iterator end() const noexcept { return cend(); }
+  const_iterator cbegin() const noexcept {
+    return const_cast<HashTable*>(this)->begin();
+  }
+  const_iterator cend() const noexcept {
+    return const_cast<HashTable*>(this)->end();
+  }
+
+  // CAPACITY
+  bool empty() const noexcept { return !size_; }
+  size_type size() const noexcept { return size_; }
+  size_type max_size() const noexcept {
+    return std::numeric_limits<size_type>::max() / (sizeof(Slot) + 1) / 2;
+  }
+
+  // HASH POLICY
+  size_type bucket_count() const noexcept { return capacity_; }
+
+  float load_factor() const noexcept {
+    return capacity_ ? static_cast<float>(size_) / capacity_ : 0.0f;
+  }
+
+  float max_load_factor() const noexcept { return max_load_factor_; }
+
+  // The table always keeps some slots empty, so probing ends; a factor of
+  // 1 or more is not possible. Rehashes only when the elements (and the
+  // deleted markers) no longer fit.
+  void max_load_factor(float factor) {
+    if (!(factor > 0.0f && factor < 1.0f)) {
+      throw std::invalid_argument("Max load factor must be in (0, 1)");
+    }
+    size_type used = GrowthFor(capacity_) - growth_left_;
+    max_load_factor_ = factor;
+    if (GrowthFor(capacity_) >= used) {
+      growth_left_ = GrowthFor(capacity_) - used;
+    } else {
+      Resize(CapacityFor(size_));
+    }
+  }
+
+  // Makes room for count elements without rehashing again.
+  void reserve(size_type count) {
+    if (count > size_ + growth_left_) {
+      Resize(CapacityFor(count));
+    }
+  }
+
+  // Rehashes into at least count slots, and at least as many as the
+  // elements need; rehash(0) shrinks the table to fit.
+  void rehash(size_type count) {
+    if (!count && !size_) {
+      Free();
+      Reset();
+      return;
+    }
+    size_type capacity = CapacityFor(size_);
+    while (capacity < count) {
+      capacity = capacity * 2 + 1;
+    }
+    if (capacity != capacity_) {
+      Resize(capacity);
+    }
+  }
+
+  // MODIFIERS
+  void clear() noexcept {
+    if (capacity_) {
+      DestroySlots();
+      std::memset(ctrl_, kEmpty, capacity_ + Group::kWidth);
+      ctrl_[capacity_] = kSentinel;
+      size_ = 0;
+      growth_left_ = GrowthFor(capacity_);
+    }
+  }
+
+  void erase(iterator pos) {
+    if (pos != end()) {
+      EraseAt(pos.slot() - slots_);
+    }
+  }
+
+  size_type erase(const key_type& key) {
+    size_type i = Find(key);
+    if (i == capacity_) {
+      return 0;
+    }
+    EraseAt(i);
+    return 1;
+  }
+
+  void swap(HashTable& other) noexcept {
+    std::swap(ctrl_, other.ctrl_);
+    std::swap(slots_, other.slots_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(size_, other.size_);
+    std::swap(growth_left_, other.growth_left_);
+    std::swap(hash_, other.hash_);
+    std::swap(equal_, other.equal_);
+    std::swap(max_load_factor_, other.max_load_factor_);
+  }
+
+  // Moves every element of other whose key is not here yet into this
+  // table; the others stay in other.
+  void merge(HashTable& other) {
+    if (this == &other) {
+      return;
+    }
+    for (size_type i = 0; i < other.capacity_; ++i) {
+      if (other.ctrl_[i] >= 0) {
+        Slot& slot = other.slots_[i];
+        size_t hash = Mix(hash_(slot.key));
+        if (FindWithHash(slot.key, hash) == capacity_) {
+          size_type j = PrepareInsert(hash);
+          try {
+            slot_traits::construct(slot_alloc_, slots_ + j, std::move(slot));
+          } catch (...) {
+            EraseCtrl(j);
+            throw;
+          }
+          other.EraseAt(i);
+        }
+      }
+    }
+  }
+
+  // LOOKUP
+  iterator find(const key_type& key) { return At(Find(key)); }
+  const_iterator find(const key_type& key) const {
+    return const_cast<HashTable*>(this)->find(key);
+  }
+
+  bool contains(const key_type& key) const { return Find(key) != capacity_; }
+  size_type count(const key_type& key) const { return contains(key); }
+
+  hasher hash_function() const { return hash_; }
+  key_equal key_eq() const { return equal_; }
+
+ protected:
+  using slot_allocator = std::allocator<Slot>;
+  using slot_traits = std::allocator_traits<slot_allocator>;
+
+  // Returns the slot of key, constructing it from key and args when the key
+  // is not there yet; the bool tells whether it was inserted.
+  template <typename K, typename... Args>
+  std::pair<iterator, bool> TryEmplace(K&& key, Args&&... args) {
+    size_t hash = Mix(hash_(key));
+    size_type i = FindWithHash(key, hash);
+    if (i != capacity_) {
+      return {At(i), false};
+    }
+    i = PrepareInsert(hash);
+    try {
+      slot_traits::construct(slot_alloc_, slots_ + i, std::forward<K>(key),
+                             std::forward<Args>(args)...);
+    } catch (...) {
+      EraseCtrl(i);
+      throw;
+    }
+    return {At(i), true};
+  }
+
+ private:
+  ctrl_t* ctrl_ = const_cast<ctrl_t*>(kEmptyGroup);
+  Slot* slots_ = nullptr;
+  size_type capacity_ = 0;
+  size_type size_ = 0;
+  size_type growth_left_ = 0;
+  Hash hash_;
+  KeyEqual equal_;
+  float max_load_factor_ = 0.875f;
+  slot_allocator slot_alloc_;
+
+  // Spreads the bits of the user's hash over the whole word, so an
+  // identity hash like std::hash<int> still fills H1 and H2.
+  static size_t Mix(size_t hash) {
+    unsigned __int128 product =
+        static_cast<unsigned __int128>(hash) * 0x9E3779B97F4A7C15ull;
+    return static_cast<size_t>(product) ^ static_cast<size_t>(product >> 64);
+  }
+
+  static size_t H1(size_t hash) { return hash >> 7; }
+  static ctrl_t H2(size_t hash) { return hash & 0x7F; }
+
+  iterator At(size_type i) noexcept {
+    return iterator(ctrl_ + i, slots_ + i);
+  }
+
+  // Returns the index of key, or capacity_ when it is not there.
+  size_type Find(const key_type& key) const {
+    return FindWithHash(key, Mix(hash_(key)));
+  }
+
+  template <typename K>
+  size_type FindWithHash(const K& key, size_t hash) const {
+    ProbeSeq seq(H1(hash), capacity_);
+    while (true) {
+      Group group(ctrl_ + seq.offset());
+      for (uint32_t match = group.Match(H2(hash)); match;
+           match &= match - 1) {
+        size_type i = seq.offset(__builtin_ctz(match));
+        if (equal_(slots_[i].key, key)) {
+          return i;
+        }
+      }
+      if (group.MaskEmpty()) {
+        return capacity_;
+      }
+      seq.next();
+    }
+  }
+
+  // The first empty or deleted slot on the probe sequence of hash.
+  size_type FindFirstNonFull(size_t hash) const {
+    ProbeSeq seq(H1(hash), capacity_);
+    while (true) {
+      uint32_t mask = Group(ctrl_ + seq.offset()).MaskEmptyOrDeleted();
+      if (mask) {
+        return seq.offset(__builtin_ctz(mask));
+      }
+      seq.next();
+    }
+  }
+
+  // Claims a slot for a new element with the given hash, growing the table
+  // when it is out of empty slots. The slot is left unconstructed.
+  size_type PrepareInsert(size_t hash) {
+    size_type i = FindFirstNonFull(hash);
+    if (!growth_left_ && ctrl_[i] != kDeleted) {
+      Grow();
+      i = FindFirstNonFull(hash);
+    }
+    growth_left_ -= ctrl_[i] == kEmpty;
+    SetCtrl(i, H2(hash));
+    ++size_;
+    return i;
+  }
+
+  void EraseAt(size_type i) {
+    slot_traits::destroy(slot_alloc_, slots_ + i);
+    EraseCtrl(i);
+  }
+
+  // Marks slot i free again. If the group starting at i and the one ending
+  // just before it together hold fewer than 16 full or deleted slots in a
+  // row around i, no probe ever saw a full group there and went on, so the
+  // slot can simply become empty.
+  void EraseCtrl(size_type i) {
+    --size_;
+    size_type before = (i - Group::kWidth) & capacity_;
+    uint32_t empty_after = Group(ctrl_ + i).MaskEmpty();
+    uint32_t empty_before = Group(ctrl_ + before).MaskEmpty();
+    bool was_never_full =
+        empty_before && empty_after &&
+        __builtin_ctz(empty_after) + (__builtin_clz(empty_before) - 16) <
+            static_cast<int>(Group::kWidth);
+    SetCtrl(i, was_never_full ? kEmpty : kDeleted);
+    growth_left_ += was_never_full;
+  }
+
+  // Sets control byte i and its copy behind the sentinel.
+  void SetCtrl(size_type i, ctrl_t h) {
+    ctrl_[i] = h;
+    ctrl_[((i - (Group::kWidth - 1)) & capacity_) +
+          ((Group::kWidth - 1) & capacity_)] = h;
+  }
+
+  size_type GrowthFor(size_type capacity) const {
+    if (!capacity) {
+      return 0;
+    }
+    size_type growth = static_cast<size_type>(capacity * max_load_factor_);
+    return growth < capacity ? growth : capacity - 1;
+  }
+
+  // The smallest capacity of the form 2^k - 1, and at least 15, that holds
+  // count elements.
+  size_type CapacityFor(size_type count) const {
+    size_type capacity = Group::kWidth - 1;
+    while (GrowthFor(capacity) < count) {
+      capacity = capacity * 2 + 1;
+    }
+    return capacity;
+  }
+
+  // Out of empty slots: rehash at the same size when at least half of the
+  // used up growth went to deleted markers, otherwise double.
+  void Grow() {
+    if (capacity_ && size_ * 2 <= GrowthFor(capacity_)) {
+      Resize(capacity_);
+    } else {
+      Resize(capacity_ ? capacity_ * 2 + 1 : CapacityFor(1));
+    }
+  }
+
+  void Resize(size_type new_capacity) {
+    ctrl_t* old_ctrl = ctrl_;
+    Slot* old_slots = slots_;
+    size_type old_capacity = capacity_;
+
+    slots_ = slot_traits::allocate(slot_alloc_, new_capacity);
+    try {
+      ctrl_ = new ctrl_t[new_capacity + Group::kWidth];
+    } catch (...) {
+      slot_traits::deallocate(slot_alloc_, slots_, new_capacity);
+      slots_ = old_slots;
+      throw;
+    }
+    std::memset(ctrl_, kEmpty, new_capacity + Group::kWidth);
+    ctrl_[new_capacity] = kSentinel;
+    capacity_ = new_capacity;
+    growth_left_ = GrowthFor(new_capacity) - size_;
+
+    for (size_type i = 0; i < old_capacity; ++i) {
+      if (old_ctrl[i] >= 0) {
+        size_t hash = Mix(hash_(old_slots[i].key));
+        size_type j = FindFirstNonFull(hash);
+        SetCtrl(j, H2(hash));
+        slot_traits::construct(slot_alloc_, slots_ + j,
+                               std::move(old_slots[i]));
+        slot_traits::destroy(slot_alloc_, old_slots + i);
+      }
+    }
+    if (old_capacity) {
+      delete[] old_ctrl;
+      slot_traits::deallocate(slot_alloc_, old_slots, old_capacity);
+    }
+  }
+
+  void DestroySlots() noexcept {
+    if constexpr (!std::is_trivially_destructible_v<Slot>) {
+      for (size_type i = 0; i < capacity_; ++i) {
+        if (ctrl_[i] >= 0) {
+          slot_traits::destroy(slot_alloc_, slots_ + i);
+        }
+      }
+    }
+  }
+
+  void Free() noexcept {
+    if (capacity_) {
+      DestroySlots();
+      delete[] ctrl_;
+      slot_traits::deallocate(slot_alloc_, slots_, capacity_);
+    }
+  }
+
+  void Reset() noexcept {
+    ctrl_ = const_cast<ctrl_t*>(kEmptyGroup);
+    slots_ = nullptr;
+    capacity_ = 0;
+    size_ = 0;
+    growth_left_ = 0;
+  }
+};
+
+// Forward iterator over the full slots. It dereferences to the key; for
+// UnorderedMap value() gives the mapped value.
+template <typename Key, typename Slot, typename Hash, typename KeyEqual>
+template <bool Const>
+class HashTable<Key, Slot, Hash, KeyEqual>::HashIterator {
+  using slot_pointer = std::conditional_t<Const, const Slot*, Slot*>;
+
+ public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = Key;
+  using difference_type = std::ptrdiff_t;
+  using pointer = const Key*;
+  using reference = const Key&;
+
+  HashIterator() : ctrl_(nullptr), slot_(nullptr) {}
+  HashIterator(ctrl_t* ctrl, slot_pointer slot) : ctrl_(ctrl), slot_(slot) {}
+
+  // An iterator converts to a const_iterator.
+  template <bool C = Const, typename = std::enable_if_t<C>>
+  HashIterator(const HashIterator<false>& other)
+      : ctrl_(other.ctrl_), slot_(other.slot_) {}
+
+  reference operator*() const { return slot_->key; }
+  pointer operator->() const { return &slot_->key; }
+
+  const Key& key() const { return slot_->key; }
+  auto& value() const { return slot_->value; }
+
+  HashIterator& operator++() {
+    ++ctrl_;
+    ++slot_;
+    SkipEmptyOrDeleted();
+    return *this;
+  }
+
+  HashIterator operator++(int) {
+    HashIterator tmp = *this;
+    ++*this;
+    return tmp;
+  }
+
+  bool operator==(const HashIterator& other) const {
+    return ctrl_ == other.ctrl_;
+  }
+  bool operator!=(const HashIterator& other) const {
+    return ctrl_ != other.ctrl_;
+  }
+
+  slot_pointer slot() const { return slot_; }
+
+ private:
+  template <bool>
+  friend class HashIterator;
+  friend class HashTable;
+
+  // Skips whole groups of free slots; the sentinel stops it at end().
+  void SkipEmptyOrDeleted() {
+    while (*ctrl_ < kSentinel) {
+      size_t shift = Group(ctrl_).CountLeadingEmptyOrDeleted();
+      ctrl_ += shift;
+      slot_ += shift;
+    }
+  }
+
+  ctrl_t* ctrl_;
+  slot_pointer slot_;
+};
+
+}  // namespace s21
+
+#endif  // S21_HASH_TABLE_H
@@ -0,0 +1,123 @@
+#ifndef S21_UNORDERED_MAP_H
+#define S21_UNORDERED_MAP_H
+
+#include <functional>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+
+#include "s21_hash_table.h"
+
+namespace s21 {
+
+// A key and its mapped value stored side by side in one table slot.
+template <typename Key, typename T>
+struct MapSlot {
+  template <typename K, typename... Args>
+  explicit MapSlot(K&& k, Args&&... args)
+      : key(std::forward<K>(k)), value(std::forward<Args>(args)...) {}
+
+  Key key;
+  T value;
+};
+
+// Hash map with the Map API on top of the Swiss table in s21_hash_table.h.
+// Elements live in the table itself, so a rehash moves them and invalidates
+// iterators and references. As with Map, iterators dereference to the key
+// and value() gives the mapped value.
+template <typename Key, typename T, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+class UnorderedMap : public HashTable<Key, MapSlot<Key, T>, Hash, KeyEqual> {
+ public:
+  using Base = HashTable<Key, MapSlot<Key, T>, Hash, KeyEqual>;
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using iterator = typename Base::iterator;
+  using const_iterator = typename Base::const_iterator;
+  using size_type = size_t;
+
+  // CONSTRUCTORS
+  using Base::Base;
+  UnorderedMap() = default;
+
+  UnorderedMap(std::initializer_list<value_type> const& items) {
+    Base::reserve(items.size());
+    for (const auto& item : items) {
+      insert(item);
+    }
+  }
+
+  // ELEMENT ACCESS
+  T& at(const Key& key) {
+    iterator it = Base::find(key);
+    if (it == Base::end()) {
+      throw std::out_of_range("Key not found in the map");
+    }
+    return it.value();
+  }
+
+  const T& at(const Key& key) const {
+    const_iterator it = Base::find(key);
+    if (it == Base::cend()) {
+      throw std::out_of_range("Key not found in the map");
+    }
+    return it.value();
+  }
+
+  T& operator[](const Key& key) { return try_emplace(key).first.value(); }
+  T& operator[](Key&& key) {
+    return try_emplace(std::move(key)).first.value();
+  }
+
+  // MODIFIERS
+  // As with Map, insert() returns end() when the key is already there, while
+  // emplace() and try_emplace() return the element that blocked them.
+  std::pair<iterator, bool> insert(const value_type& value) {
+    return NotBlocking(Base::TryEmplace(value.first, value.second));
+  }
+
+  std::pair<iterator, bool> insert(value_type&& value) {
+    return NotBlocking(Base::TryEmplace(value.first, std::move(value.second)));
+  }
+
+  std::pair<iterator, bool> insert(const Key& key, const T& obj) {
+    return NotBlocking(Base::TryEmplace(key, obj));
+  }
+
+  std::pair<iterator, bool> insert_or_assign(const Key& key, const T& obj) {
+    auto result = Base::TryEmplace(key, obj);
+    if (!result.second) {
+      result.first.value() = obj;
+    }
+    return result;
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args&&... args) {
+    std::pair<key_type, mapped_type> value(std::forward<Args>(args)...);
+    return Base::TryEmplace(std::move(value.first), std::move(value.second));
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const key_type& key, Args&&... args) {
+    return Base::TryEmplace(key, std::forward<Args>(args)...);
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(key_type&& key, Args&&... args) {
+    return Base::TryEmplace(std::move(key), std::forward<Args>(args)...);
+  }
+
+ private:
+  std::pair<iterator, bool> NotBlocking(std::pair<iterator, bool> result) {
+    if (!result.second) {
+      result.first = Base::end();
+    }
+    return result;
+  }
+};
+
+}  // namespace s21
+
+#endif  // S21_UNORDERED_MAP_H
@@ -0,0 +1,269 @@
+#include "s21_unordered_map.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace {
+
+template <typename Key, typename T, typename Hash>
+void ExpectSame(const s21::UnorderedMap<Key, T, Hash> &map,
+                const std::unordered_map<Key, T> &expected) {
+  ASSERT_EQ(map.size(), expected.size());
+  size_t visited = 0;
+  for (auto it = map.cbegin(); it != map.cend(); ++it, ++visited) {
+    auto found = expected.find(it.key());
+    ASSERT_NE(found, expected.end());
+    EXPECT_EQ(it.value(), found->second);
+  }
+  EXPECT_EQ(visited, expected.size());
+}
+
+// Sends every key to the same few buckets, so probing has to walk groups.
+struct CollidingHash {
+  size_t operator()(int key) const { return key % 3; }
+};
+
+// Its move constructor throws while armed is set.
+struct MoveThrows {
+  static inline bool armed = false;
+
+  MoveThrows(int v = 0) : value(v) {}
+  MoveThrows(const MoveThrows &other) = default;
+  MoveThrows(MoveThrows &&other) : value(other.value) {
+    if (armed) throw std::runtime_error("move");
+  }
+  MoveThrows &operator=(const MoveThrows &other) = default;
+
+  int value;
+};
+
+}  // namespace
+
+TEST(TestUnorderedMapConstructor, Empty) {
+  s21::UnorderedMap<int, int> map;
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.size(), 0U);
+  EXPECT_EQ(map.begin(), map.end());
+  EXPECT_EQ(map.bucket_count(), 0U);
+  EXPECT_FALSE(map.contains(1));
+  EXPECT_EQ(map.find(1), map.end());
+  EXPECT_EQ(map.erase(1), 0U);
+}
+
+TEST(TestUnorderedMapConstructor, InitializerList) {
+  s21::UnorderedMap<std::string, int> map = {{"a", 1}, {"b", 2}, {"a", 3}};
+  ExpectSame(map, {{"a", 1}, {"b", 2}});
+}
+
+TEST(TestUnorderedMapConstructor, BucketCountReserves) {
+  s21::UnorderedMap<int, int> map(100);
+  size_t buckets = map.bucket_count();
+  EXPECT_GE(buckets * map.max_load_factor(), 100.0f);
+  for (int i = 0; i < 100; ++i) {
+    map[i] = i;
+  }
+  EXPECT_EQ(map.bucket_count(), buckets);
+}
+
+TEST(TestUnorderedMapConstructor, CopyAndMove) {
+  s21::UnorderedMap<std::string, std::string> map;
+  for (int i = 0; i < 100; ++i) {
+    map[std::to_string(i)] = std::string(30, 'a' + i % 26);
+  }
+  s21::UnorderedMap<std::string, std::string> copy(map);
+  EXPECT_EQ(copy.size(), 100U);
+  EXPECT_EQ(copy.at("42"), map.at("42"));
+  s21::UnorderedMap<std::string, std::string> moved(std::move(map));
+  EXPECT_EQ(moved.size(), 100U);
+  EXPECT_TRUE(map.empty());
+  map = copy;
+  EXPECT_EQ(map.size(), 100U);
+  copy = std::move(moved);
+  EXPECT_EQ(copy.at("7"), map.at("7"));
+  map["new"] = "value";
+  EXPECT_FALSE(copy.contains("new"));
+}
+
+TEST(TestUnorderedMapAccess, AtAndSubscript) {
+  s21::UnorderedMap<std::string, int> map;
+  map["one"] = 1;
+  map["two"] += 2;
+  EXPECT_EQ(map.at("one"), 1);
+  EXPECT_EQ(map["two"], 2);
+  EXPECT_THROW(map.at("three"), std::out_of_range);
+  const auto &cmap = map;
+  EXPECT_EQ(cmap.at("two"), 2);
+  EXPECT_THROW(cmap.at("zero"), std::out_of_range);
+}
+
+TEST(TestUnorderedMapModifiers, InsertReturnsEndOnDuplicate) {
+  s21::UnorderedMap<int, std::string> map;
+  auto res = map.insert({1, "one"});
+  EXPECT_TRUE(res.second);
+  EXPECT_EQ(*res.first, 1);
+  EXPECT_EQ(res.first.value(), "one");
+  res = map.insert(1, "uno");
+  EXPECT_FALSE(res.second);
+  EXPECT_EQ(res.first, map.end());
+  EXPECT_EQ(map.at(1), "one");
+}
+
+TEST(TestUnorderedMapModifiers, EmplaceAndTryEmplace) {
+  s21::UnorderedMap<int, std::unique_ptr<int>> map;
+  EXPECT_TRUE(map.emplace(1, std::make_unique<int>(1)).second);
+  EXPECT_TRUE(map.try_emplace(2, std::make_unique<int>(2)).second);
+  auto res = map.try_emplace(1, std::make_unique<int>(3));
+  EXPECT_FALSE(res.second);
+  EXPECT_EQ(*res.first.value(), 1);
+  for (int i = 3; i < 1000; ++i) {
+    map.try_emplace(i, std::make_unique<int>(i));
+  }
+  EXPECT_EQ(*map.at(999), 999);
+}
+
+TEST(TestUnorderedMapModifiers, InsertOrAssign) {
+  s21::UnorderedMap<int, std::string> map = {{1, "one"}};
+  EXPECT_FALSE(map.insert_or_assign(1, "uno").second);
+  EXPECT_TRUE(map.insert_or_assign(2, "dos").second);
+  ExpectSame(map, {{1, "uno"}, {2, "dos"}});
+}
+
+TEST(TestUnorderedMapModifiers, EraseAndClear) {
+  s21::UnorderedMap<int, std::string> map = {{1, "a"}, {2, "b"}, {3, "c"}};
+  map.erase(map.find(2));
+  map.erase(map.end());
+  EXPECT_EQ(map.erase(3), 1U);
+  EXPECT_EQ(map.erase(3), 0U);
+  ExpectSame(map, {{1, "a"}});
+  size_t buckets = map.bucket_count();
+  map.clear();
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.begin(), map.end());
+  EXPECT_EQ(map.bucket_count(), buckets);
+  map[5] = "e";
+  ExpectSame(map, {{5, "e"}});
+}
+
+TEST(TestUnorderedMapModifiers, SwapAndMerge) {
+  s21::UnorderedMap<int, int> a = {{1, 1}, {2, 2}};
+  s21::UnorderedMap<int, int> b = {{2, 20}, {3, 30}};
+  a.merge(b);
+  ExpectSame(a, {{1, 1}, {2, 2}, {3, 30}});
+  ExpectSame(b, {{2, 20}});
+  a.swap(b);
+  ExpectSame(a, {{2, 20}});
+  ExpectSame(b, {{1, 1}, {2, 2}, {3, 30}});
+}
+
+TEST(TestUnorderedMapModifiers, MergeThrowingMoveLeavesBothIntact) {
+  s21::UnorderedMap<int, MoveThrows> a = {{1, 1}};
+  s21::UnorderedMap<int, MoveThrows> b = {{2, 2}, {3, 3}};
+  MoveThrows::armed = true;
+  EXPECT_THROW(a.merge(b), std::runtime_error);
+  MoveThrows::armed = false;
+  EXPECT_EQ(a.size(), 1u);
+  EXPECT_EQ(b.size(), 2u);
+  EXPECT_EQ(a.at(1).value, 1);
+  EXPECT_EQ(a.find(2), a.end());
+  EXPECT_EQ(a.find(3), a.end());
+  EXPECT_EQ(b.at(2).value, 2);
+  EXPECT_EQ(b.at(3).value, 3);
+  a.merge(b);
+  EXPECT_EQ(a.size(), 3u);
+  EXPECT_TRUE(b.empty());
+}
+
+TEST(TestUnorderedMapHashPolicy, MaxLoadFactor) {
+  s21::UnorderedMap<int, int> map;
+  EXPECT_THROW(map.max_load_factor(1.0f), std::invalid_argument);
+  EXPECT_THROW(map.max_load_factor(0.0f), std::invalid_argument);
+  map.max_load_factor(0.5f);
+  for (int i = 0; i < 1000; ++i) {
+    map[i] = i;
+    EXPECT_LE(map.load_factor(), 0.5f);
+  }
+  map.max_load_factor(0.25f);
+  EXPECT_LE(map.load_factor(), 0.25f);
+  EXPECT_EQ(map.size(), 1000U);
+  EXPECT_EQ(map.at(500), 500);
+}
+
+TEST(TestUnorderedMapHashPolicy, ReserveAndRehash) {
+  s21::UnorderedMap<int, int> map;
+  map.reserve(1000);
+  size_t buckets = map.bucket_count();
+  for (int i = 0; i < 1000; ++i) {
+    map[i] = i;
+  }
+  EXPECT_EQ(map.bucket_count(), buckets);
+  for (int i = 0; i < 990; ++i) {
+    map.erase(i);
+  }
+  map.rehash(0);
+  EXPECT_LT(map.bucket_count(), buckets);
+  EXPECT_EQ(map.size(), 10U);
+  EXPECT_EQ(map.at(995), 995);
+  map.clear();
+  map.rehash(0);
+  EXPECT_EQ(map.bucket_count(), 0U);
+}
+
+TEST(TestUnorderedMapHashPolicy, CollidingKeys) {
+  s21::UnorderedMap<int, int, CollidingHash> map;
+  for (int i = 0; i < 300; ++i) {
+    map[i] = i;
+  }
+  for (int i = 0; i < 300; i += 2) {
+    map.erase(i);
+  }
+  for (int i = 0; i < 300; ++i) {
+    EXPECT_EQ(map.contains(i), i % 2 == 1);
+  }
+}
+
+// Churn that keeps the size steady must reuse the freed slots instead of
+// growing the table without bound.
+TEST(TestUnorderedMapHashPolicy, ChurnDoesNotGrow) {
+  s21::UnorderedMap<int, int> map;
+  for (int i = 0; i < 1000; ++i) {
+    map[i] = i;
+  }
+  size_t buckets = map.bucket_count();
+  for (int i = 1000; i < 100000; ++i) {
+    map.erase(i - 1000);
+    map[i] = i;
+  }
+  EXPECT_EQ(map.size(), 1000U);
+  EXPECT_LE(map.bucket_count(), buckets * 2 + 1);
+}
+
+TEST(TestUnorderedMapLookup, MatchesStdUnorderedMap) {
+  std::mt19937 gen(21);
+  s21::UnorderedMap<int, int> map;
+  std::unordered_map<int, int> expected;
+  for (int step = 0; step < 20000; ++step) {
+    int key = gen() % 2000;
+    switch (gen() % 4) {
+      case 0:
+        map.insert(key, step);
+        expected.insert({key, step});
+        break;
+      case 1:
+        map[key] = step;
+        expected[key] = step;
+        break;
+      case 2:
+        EXPECT_EQ(map.erase(key), expected.erase(key));
+        break;
+      default:
+        EXPECT_EQ(map.count(key), expected.count(key));
+    }
+  }
+  ExpectSame(map, expected);
+}
@@ -0,0 +1,71 @@
+#ifndef S21_UNORDERED_SET_H
+#define S21_UNORDERED_SET_H
+
+#include <functional>
+#include <initializer_list>
+#include <utility>
+
+#include "s21_hash_table.h"
+
+namespace s21 {
+
+// A set element alone in its table slot.
+template <typename Key>
+struct SetSlot {
+  template <typename K>
+  explicit SetSlot(K&& k) : key(std::forward<K>(k)) {}
+
+  Key key;
+};
+
+// Hash set with the Set API on top of the Swiss table in s21_hash_table.h.
+template <typename Key, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+class UnorderedSet : public HashTable<Key, SetSlot<Key>, Hash, KeyEqual> {
+ public:
+  using Base = HashTable<Key, SetSlot<Key>, Hash, KeyEqual>;
+  using key_type = Key;
+  using value_type = Key;
+  using iterator = typename Base::iterator;
+  using const_iterator = typename Base::const_iterator;
+  using size_type = size_t;
+
+  // CONSTRUCTORS
+  using Base::Base;
+  UnorderedSet() = default;
+
+  UnorderedSet(std::initializer_list<value_type> const& items) {
+    Base::reserve(items.size());
+    for (const auto& item : items) {
+      Base::TryEmplace(item);
+    }
+  }
+
+  // MODIFIERS
+  // As with Set, insert() returns end() when the key is already there, while
+  // emplace() returns the element that blocked it.
+  std::pair<iterator, bool> insert(const value_type& value) {
+    return NotBlocking(Base::TryEmplace(value));
+  }
+
+  std::pair<iterator, bool> insert(value_type&& value) {
+    return NotBlocking(Base::TryEmplace(std::move(value)));
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args&&... args) {
+    return Base::TryEmplace(Key(std::forward<Args>(args)...));
+  }
+
+ private:
+  std::pair<iterator, bool> NotBlocking(std::pair<iterator, bool> result) {
+    if (!result.second) {
+      result.first = Base::end();
+    }
+    return result;
+  }
+};
+
+}  // namespace s21
+
+#endif  // S21_UNORDERED_SET_H
@@ -0,0 +1,79 @@
+#include "s21_unordered_set.h"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+#include <unordered_set>
+
+TEST(TestUnorderedSet, InsertAndFind) {
+  s21::UnorderedSet<std::string> set = {"apple", "pear", "apple"};
+  EXPECT_EQ(set.size(), 2U);
+  auto res = set.insert("fig");
+  EXPECT_TRUE(res.second);
+  EXPECT_EQ(*res.first, "fig");
+  res = set.insert("pear");
+  EXPECT_FALSE(res.second);
+  EXPECT_EQ(res.first, set.end());
+  auto blocked = set.emplace(5, 'a');
+  EXPECT_TRUE(blocked.second);
+  blocked = set.emplace("aaaaa");
+  EXPECT_FALSE(blocked.second);
+  EXPECT_EQ(*blocked.first, "aaaaa");
+  EXPECT_TRUE(set.contains("apple"));
+  EXPECT_EQ(set.count("plum"), 0U);
+  EXPECT_EQ(*set.find("fig"), "fig");
+}
+
+TEST(TestUnorderedSet, IterationVisitsEveryKeyOnce) {
+  s21::UnorderedSet<int> set;
+  for (int i = 0; i < 1000; ++i) {
+    set.insert(i * 7);
+  }
+  for (int i = 0; i < 1000; i += 3) {
+    set.erase(i * 7);
+  }
+  std::unordered_set<int> seen;
+  for (int key : set) {
+    EXPECT_EQ(key % 7, 0);
+    EXPECT_NE(key / 7 % 3, 0);
+    EXPECT_TRUE(seen.insert(key).second);
+  }
+  EXPECT_EQ(seen.size(), set.size());
+}
+
+TEST(TestUnorderedSet, CopyMoveSwapMerge) {
+  s21::UnorderedSet<int> a = {1, 2, 3};
+  s21::UnorderedSet<int> b(a);
+  b.insert(4);
+  s21::UnorderedSet<int> c(std::move(b));
+  EXPECT_TRUE(b.empty());
+  EXPECT_EQ(c.size(), 4U);
+  s21::UnorderedSet<int> d = {3, 5};
+  a.merge(d);
+  EXPECT_EQ(a.size(), 4U);
+  EXPECT_TRUE(a.contains(5));
+  EXPECT_EQ(d.size(), 1U);
+  EXPECT_TRUE(d.contains(3));
+  a.swap(d);
+  EXPECT_EQ(a.size(), 1U);
+  EXPECT_EQ(d.size(), 4U);
+}
+
+TEST(TestUnorderedSet, MatchesStdUnorderedSet) {
+  std::mt19937 gen(21);
+  s21::UnorderedSet<unsigned> set;
+  std::unordered_set<unsigned> expected;
+  for (int step = 0; step < 20000; ++step) {
+    unsigned key = gen() % 3000;
+    if (gen() % 2) {
+      EXPECT_EQ(set.insert(key).second, expected.insert(key).second);
+    } else {
+      EXPECT_EQ(set.erase(key), expected.erase(key));
+    }
+  }
+  EXPECT_EQ(set.size(), expected.size());
+  for (unsigned key : expected) {
+    EXPECT_TRUE(set.contains(key));
+  }
+}
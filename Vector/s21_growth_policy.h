@@ -0,0 +1,84 @@
+#ifndef S21_GROWTH_POLICY_H
+#define S21_GROWTH_POLICY_H
+
+#include <cstddef>
+#include <limits>
+
+namespace s21 {
+
+// Growth policies decide how much a Vector allocates once it runs out of
+// room. Grow() gets the current capacity, the number of elements that have
+// to fit and the element size, and returns the new capacity, which is never
+// below required. The first allocation holds at least MinCapacity elements.
+
+// Multiplies the capacity by Num / Den: 2/1 keeps reallocations rare, 3/2
+// wastes less memory and lets freed blocks be reused by later growth.
+template <size_t Num, size_t Den, size_t MinCapacity = 1>
+struct GeometricGrowth {
+  static_assert(Num > Den && Den > 0, "The growth factor must exceed 1");
+
+  static size_t Grow(size_t capacity, size_t required, size_t) {
+    size_t next = capacity < std::numeric_limits<size_t>::max() / Num
+                      ? capacity / Den * Num + capacity % Den * Num / Den
+                      : required;
+    if (next <= capacity) {
+      next = capacity + 1;
+    }
+    if (next < MinCapacity) {
+      next = MinCapacity;
+    }
+    return next < required ? required : next;
+  }
+};
+
+template <size_t MinCapacity = 1>
+using DoublingGrowth = GeometricGrowth<2, 1, MinCapacity>;
+
+template <size_t MinCapacity = 1>
+using OneAndHalfGrowth = GeometricGrowth<3, 2, MinCapacity>;
+
+// Adds Step elements at a time: the slack never exceeds Step elements, at
+// the price of a linear number of reallocations.
+template <size_t Step, size_t MinCapacity = Step>
+struct FixedStepGrowth {
+  static_assert(Step > 0, "The step must not be zero");
+
+  static size_t Grow(size_t capacity, size_t required, size_t) {
+    size_t next = capacity + Step;
+    if (next < MinCapacity) {
+      next = MinCapacity;
+    }
+    return next < required ? required : next;
+  }
+};
+
+// Rounds the capacity chosen by Base up to what the allocator hands out
+// anyway: small blocks to the next power of two bytes, as malloc size
+// classes go, and large ones to whole pages.
+template <typename Base = DoublingGrowth<>, size_t PageSize = 4096>
+struct PageRoundedGrowth {
+  static_assert((PageSize & (PageSize - 1)) == 0,
+                "The page size must be a power of two");
+
+  static size_t Grow(size_t capacity, size_t required, size_t value_size) {
+    size_t next = Base::Grow(capacity, required, value_size);
+    if (next > std::numeric_limits<size_t>::max() / value_size - PageSize) {
+      return next;
+    }
+    size_t bytes = next * value_size;
+    size_t rounded = PageSize;
+    if (bytes < PageSize) {
+      rounded = 16;
+      while (rounded < bytes) {
+        rounded *= 2;
+      }
+    } else {
+      rounded = (bytes + PageSize - 1) & ~(PageSize - 1);
+    }
+    return rounded / value_size;
+  }
+};
+
+}  // namespace s21
+
+#endif  // S21_GROWTH_POLICY_H
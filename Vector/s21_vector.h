@@ -2,13 +2,32 @@
 #define S21_VECTOR_H
 
 #include <algorithm>
+#include <cstring>
 #include <initializer_list>
 #include <iostream>
 #include <memory>
 #include <stdexcept>
+#include <type_traits>
+
+#include "s21_growth_policy.h"
 
 namespace s21 {
+
+// Types whose objects can be moved to new storage with memcpy, after which
+// the old bytes are simply dropped without running the destructor. True for
+// trivially copyable types; other types opt in by specialising it, which is
+// safe as long as the object does not point into itself or register its
+// address anywhere.
+template <typename T>
+struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+
 template <typename T>
+inline constexpr bool is_trivially_relocatable_v =
+    is_trivially_relocatable<T>::value;
+
+// GrowthPolicy picks the capacity whenever the vector has to reallocate,
+// see s21_growth_policy.h. reserve() and shrink_to_fit() are exact.
+template <typename T, typename GrowthPolicy = DoublingGrowth<>>
 class Vector {
  public:
   using value_type = T;
@@ -18,6 +37,7 @@ class Vector {
   using iterator = T *;
   using const_iterator = const T *;
   using Allocator = std::allocator<T>;
+  using growth_policy = GrowthPolicy;
 
   // CONSTRUCTORS
   Vector() noexcept : alloc_(), size_(0), capacity_(0), data_(nullptr) {}
@@ -44,7 +64,7 @@ class Vector {
   Vector(const Vector &other)
       : alloc_(),
         size_(other.size_),
-        capacity_(other.capacity_),
+        capacity_(other.size_),
         data_(alloc_.allocate(size_)) {
     std::uninitialized_copy_n(other.data_, size_, data_);
   }
@@ -174,54 +194,63 @@ class Vector {
     size_ = 0;
   }
 
-  iterator insert(iterator pos, const T &value) {
-    if (pos > end() || pos < begin())
+  iterator insert(const_iterator pos, const T &value) {
+    return emplace(pos, value);
+  }
+
+  iterator insert(const_iterator pos, T &&value) {
+    return emplace(pos, std::move(value));
+  }
+
+  // Constructs an element from args before pos. In the middle the value is
+  // built aside first, because args may refer to an element being shifted.
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args &&...args) {
+    if (pos > cend() || pos < cbegin())
       throw std::out_of_range("Position out of range");
-    else {
-      if (size_ == capacity_) {
-        size_type ind = pos - data_;
-        MoveData(size_ * 2);
-        pos = data_ + ind;
-      }
-      if (pos != end()) {
-        iterator iter = end();
-        std::uninitialized_move_n(iter - 1, 1, iter);
-        --iter;
-        while (iter > pos) {
-          *iter = std::move(*(iter - 1));
-          --iter;
-        }
-      }
-      ++size_;
-      std::allocator_traits<Allocator>::construct(alloc_, pos, value);
-      return pos;
+    size_type ind = pos - cbegin();
+    if (ind == size_) {
+      emplace_back(std::forward<Args>(args)...);
+      return data_ + ind;
     }
+    value_type value(std::forward<Args>(args)...);
+    if (size_ == capacity_) {
+      MoveData(NextCapacity(size_ + 1));
+    }
+    iterator it = data_ + ind;
+    std::allocator_traits<Allocator>::construct(alloc_, end(),
+                                                std::move(back()));
+    std::move_backward(it, end() - 1, end());
+    *it = std::move(value);
+    ++size_;
+    return it;
   }
 
+  // The tail is shifted down by move assignment and the then moved-from
+  // last element is destroyed, so no element is assigned after its
+  // destructor has run.
   iterator erase(const_iterator pos) {
-    if (pos >= end() || pos < begin())
+    if (pos >= cend() || pos < cbegin())
       throw std::out_of_range("Position out of range");
-    else {
-      std::allocator_traits<Allocator>::destroy(alloc_, pos);
-      iterator dest = iterator(const_cast<T *>(pos));
-      iterator from = dest + 1;
-      while (from != end()) {
-        *dest++ = std::move(*from++);
-      }
-      --size_;
-      return iterator(const_cast<T *>(pos));
-    }
+    iterator it = data_ + (pos - cbegin());
+    std::move(it + 1, end(), it);
+    pop_back();
+    return it;
   }
 
-  void push_back(const_reference value) {
-    if (!capacity_) {
-      ++capacity_;
-      data_ = std::allocator_traits<Allocator>::allocate(alloc_, capacity_);
-    } else if (size_ == capacity_) {
-      MoveData(capacity_ * 2);
+  void push_back(const_reference value) { emplace_back(value); }
+  void push_back(T &&value) { emplace_back(std::move(value)); }
+
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    if (size_ == capacity_) {
+      GrowAndEmplaceBack(std::forward<Args>(args)...);
+    } else {
+      std::allocator_traits<Allocator>::construct(alloc_, end(),
+                                                  std::forward<Args>(args)...);
     }
-    std::allocator_traits<Allocator>::construct(alloc_, end(), value);
     ++size_;
+    return back();
   }
 
   void pop_back() {
@@ -239,10 +268,15 @@ class Vector {
       }
       size_ = count;
     } else if (count > size_) {
-      size_type new_cap = count > capacity_ * 2 ? count : capacity_ * 2;
-      MoveData(new_cap);
-      Fill(end(), count - size_, value);
-      capacity_ = size_ = new_cap;
+      if (count > capacity_) {
+        // value may refer to an element, which moves with the buffer
+        value_type copy(value);
+        MoveData(NextCapacity(count));
+        std::uninitialized_fill_n(end(), count - size_, copy);
+      } else {
+        std::uninitialized_fill_n(end(), count - size_, value);
+      }
+      size_ = count;
     }
   }
 
@@ -288,12 +322,7 @@ class Vector {
     }
   }
 
-  void Destroy() {
-    value_type *it = data_ + size_;
-    while (it != data_) {
-      alloc_.destroy(--it);
-    }
-  }
+  void Destroy() { std::destroy_n(data_, size_); }
 
   void Fill(iterator start, size_type count, const_reference value) {
     try {
@@ -304,23 +333,87 @@ class Vector {
     }
   }
 
+  size_type NextCapacity(size_type required) const {
+    return GrowthPolicy::Grow(capacity_, required, sizeof(value_type));
+  }
+
+  // Moves the elements into a new buffer of new_cap elements.
   void MoveData(size_type new_cap) {
-    // allocate memory
     value_type *new_data = alloc_.allocate(new_cap);
-
     try {
-      // copy old values into the new location
-      std::uninitialized_copy_n(begin(), size_, new_data);
+      Relocate(new_data);
     } catch (...) {
       alloc_.deallocate(new_data, new_cap);
       throw;
     }
+    Release();
+    data_ = new_data;
+    capacity_ = new_cap;
+  }
 
-    Uncreate();
+  // Grows the buffer and constructs the new last element from args. The
+  // element is built in the new buffer before the old elements move, so
+  // args may refer to one of them.
+  template <typename... Args>
+  void GrowAndEmplaceBack(Args &&...args) {
+    size_type new_cap = NextCapacity(size_ + 1);
+    value_type *new_data = alloc_.allocate(new_cap);
+    try {
+      std::allocator_traits<Allocator>::construct(
+          alloc_, new_data + size_, std::forward<Args>(args)...);
+    } catch (...) {
+      alloc_.deallocate(new_data, new_cap);
+      throw;
+    }
+    try {
+      Relocate(new_data);
+    } catch (...) {
+      std::allocator_traits<Allocator>::destroy(alloc_, new_data + size_);
+      alloc_.deallocate(new_data, new_cap);
+      throw;
+    }
+    Release();
     data_ = new_data;
     capacity_ = new_cap;
   }
+
+  // Transfers the elements into new_data. Relocatable types are copied
+  // bytewise; for the others the move constructor is used when it cannot
+  // throw (or there is no copy constructor), and otherwise copies are made
+  // so the vector stays intact if one of them throws.
+  void Relocate(value_type *new_data) {
+    if constexpr (is_trivially_relocatable_v<value_type>) {
+      if (size_) {
+        std::memcpy(static_cast<void *>(new_data),
+                    static_cast<const void *>(data_),
+                    size_ * sizeof(value_type));
+      }
+    } else if constexpr (std::is_nothrow_move_constructible_v<value_type> ||
+                         !std::is_copy_constructible_v<value_type>) {
+      std::uninitialized_move_n(begin(), size_, new_data);
+    } else {
+      std::uninitialized_copy_n(begin(), size_, new_data);
+    }
+  }
+
+  // Frees the old buffer once Relocate has succeeded. Bytewise relocated
+  // elements now live in the new buffer, so their destructors do not run.
+  void Release() {
+    if constexpr (is_trivially_relocatable_v<value_type>) {
+      if (data_) {
+        alloc_.deallocate(data_, capacity_);
+      }
+    } else {
+      Uncreate();
+    }
+  }
 };
+
+// A vector only holds a pointer to its buffer, so it can be relocated
+// bytewise, which makes growing a Vector of Vectors a plain memcpy.
+template <typename T, typename GrowthPolicy>
+struct is_trivially_relocatable<Vector<T, GrowthPolicy>> : std::true_type {};
+
 }  // namespace s21
 
 // #include "vector.tpp"
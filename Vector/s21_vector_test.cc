@@ -2,6 +2,7 @@
 
 #include <gtest/gtest.h>
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -124,6 +125,17 @@ TEST(TestVectorInsert, InsertFirst) {
   }
 }
 
+TEST(TestVectorInsert, InsertIntoEmpty) {
+  s21::Vector<int> V;
+  V.insert(V.begin(), 1);
+  V.insert(V.begin(), 0);
+  V.insert(V.end(), 2);
+  ASSERT_EQ(V.size(), 3u);
+  for (size_t i = 0; i < V.size(); i++) {
+    ASSERT_EQ(V.at(i), static_cast<int>(i));
+  }
+}
+
 TEST(TestVectorInsert, InsertSecond) {
   s21::Vector<int> V = {1, 2, 3, 4, 5};
   auto it = V.end();
@@ -1463,3 +1475,222 @@ TEST(TestVectorAtFunction, AccessOutOfRangeNegativeIndex) {
   s21::Vector<int> V = {1, 2, 3};
   ASSERT_THROW(V.at(-1), std::out_of_range);
 }
+
+// Counts how often it is copied and moved while the vector grows.
+template <bool NoexceptMove>
+struct Tracked {
+  static inline int copies = 0;
+  static inline int moves = 0;
+
+  explicit Tracked(int v = 0) : value(v) {}
+  Tracked(const Tracked &other) : value(other.value) { ++copies; }
+  Tracked(Tracked &&other) noexcept(NoexceptMove) : value(other.value) {
+    ++moves;
+  }
+  Tracked &operator=(const Tracked &other) = default;
+  Tracked &operator=(Tracked &&other) = default;
+
+  int value;
+};
+
+TEST(TestVectorGrowth, MovesNoexceptElements) {
+  using Item = Tracked<true>;
+  s21::Vector<Item> V;
+  for (int i = 0; i < 100; i++) {
+    Item item(i);
+    V.push_back(item);
+  }
+  ASSERT_EQ(Item::copies, 100);  // one per push_back
+  ASSERT_GT(Item::moves, 0);
+  for (int i = 0; i < 100; i++) {
+    ASSERT_EQ(V[i].value, i);
+  }
+}
+
+TEST(TestVectorGrowth, CopiesThrowingMoveElements) {
+  using Item = Tracked<false>;
+  s21::Vector<Item> V;
+  for (int i = 0; i < 100; i++) {
+    Item item(i);
+    V.push_back(item);
+  }
+  ASSERT_EQ(Item::moves, 0);
+  ASSERT_GT(Item::copies, 100);
+}
+
+TEST(TestVectorGrowth, Strings) {
+  s21::Vector<std::string> V;
+  std::vector<std::string> V2;
+  for (int i = 0; i < 100; i++) {
+    V.push_back(std::string(40, static_cast<char>('a' + i % 26)));
+    V2.push_back(std::string(40, static_cast<char>('a' + i % 26)));
+  }
+  V.shrink_to_fit();
+  ASSERT_EQ(V.size(), V2.size());
+  ASSERT_TRUE(std::equal(V.begin(), V.end(), V2.begin()));
+}
+
+TEST(TestVectorGrowth, NestedVectors) {
+  static_assert(s21::is_trivially_relocatable_v<s21::Vector<std::string>>);
+  s21::Vector<s21::Vector<int>> V;
+  for (int i = 0; i < 50; i++) {
+    V.push_back(s21::Vector<int>(i, i));
+  }
+  V.reserve(1000);
+  for (int i = 0; i < 50; i++) {
+    ASSERT_EQ(V[i].size(), static_cast<size_t>(i));
+    for (size_t j = 0; j < V[i].size(); j++) {
+      ASSERT_EQ(V[i][j], i);
+    }
+  }
+}
+
+// Opts in to bytewise relocation although it has a user-provided move.
+struct Handle {
+  explicit Handle(int v = 0) : value(new int(v)) {}
+  Handle(const Handle &other) : value(new int(*other.value)) {}
+  Handle &operator=(const Handle &other) {
+    *value = *other.value;
+    return *this;
+  }
+  ~Handle() { delete value; }
+
+  int *value;
+};
+
+template <>
+struct s21::is_trivially_relocatable<Handle> : std::true_type {};
+
+TEST(TestVectorGrowth, RelocatableOptIn) {
+  s21::Vector<Handle> V;
+  for (int i = 0; i < 100; i++) {
+    V.push_back(Handle(i));
+  }
+  for (int i = 0; i < 100; i++) {
+    ASSERT_EQ(*V[i].value, i);
+  }
+}
+
+TEST(TestVectorEmplace, MoveOnlyElements) {
+  s21::Vector<std::unique_ptr<int>> V;
+  for (int i = 0; i < 20; i++) {
+    V.emplace_back(new int(i));
+  }
+  V.push_back(std::make_unique<int>(20));
+  V.emplace(V.begin(), std::make_unique<int>(-1));
+  V.insert(V.begin() + 5, std::make_unique<int>(100));
+  ASSERT_EQ(V.size(), 23u);
+  ASSERT_EQ(*V[0], -1);
+  ASSERT_EQ(*V[5], 100);
+  ASSERT_EQ(*V[6], 4);
+  ASSERT_EQ(*V.back(), 20);
+}
+
+TEST(TestVectorEmplace, EmplaceBackReturnsElement) {
+  s21::Vector<std::string> V;
+  std::string &s = V.emplace_back(3, 'x');
+  ASSERT_EQ(s, "xxx");
+  ASSERT_EQ(&s, &V.back());
+}
+
+TEST(TestVectorEmplace, PushBackMovesValue) {
+  s21::Vector<std::string> V;
+  std::string value(100, 'a');
+  V.push_back(std::move(value));
+  ASSERT_EQ(V[0], std::string(100, 'a'));
+  ASSERT_TRUE(value.empty());
+}
+
+TEST(TestVectorEmplace, PushOwnElementOnGrowth) {
+  s21::Vector<std::string> V;
+  V.push_back(std::string(40, 'a'));
+  while (V.size() != V.capacity()) V.push_back("filler");
+  V.push_back(V.front());
+  ASSERT_EQ(V.back(), std::string(40, 'a'));
+  V.emplace(V.begin() + 1, V.front());
+  ASSERT_EQ(V[1], std::string(40, 'a'));
+}
+
+TEST(TestVectorResize, GrowsWithinCapacity) {
+  s21::Vector<int> V;
+  V.resize(100, 7);
+  V.resize(10);
+  const int *data = V.data();
+  V.resize(50, 3);
+  ASSERT_EQ(V.size(), 50u);
+  ASSERT_EQ(V.capacity(), 100u);
+  ASSERT_EQ(V.data(), data);
+  ASSERT_EQ(V[9], 7);
+  ASSERT_EQ(V[10], 3);
+  ASSERT_EQ(V[49], 3);
+}
+
+TEST(TestVectorResize, MatchesStd) {
+  s21::Vector<std::string> V;
+  std::vector<std::string> V2;
+  for (size_t count : {3u, 1u, 10u, 25u, 4u, 40u}) {
+    V.resize(count, "x");
+    V2.resize(count, "x");
+    ASSERT_EQ(V.size(), V2.size());
+    ASSERT_TRUE(std::equal(V.begin(), V.end(), V2.begin()));
+  }
+}
+
+TEST(TestVectorResize, OwnElementAsValue) {
+  s21::Vector<std::string> V(2, std::string(40, 'a'));
+  V.resize(100, V[0]);
+  ASSERT_EQ(V[99], std::string(40, 'a'));
+}
+
+template <typename Vec>
+std::vector<size_t> Capacities(size_t count) {
+  Vec V;
+  std::vector<size_t> res;
+  for (size_t i = 0; i < count; i++) {
+    V.push_back(static_cast<int>(i));
+    if (res.empty() || res.back() != V.capacity()) {
+      res.push_back(V.capacity());
+    }
+  }
+  return res;
+}
+
+TEST(TestVectorGrowthPolicy, Doubling) {
+  using Caps = std::vector<size_t>;
+  ASSERT_EQ(Capacities<s21::Vector<int>>(20), (Caps{1, 2, 4, 8, 16, 32}));
+  ASSERT_EQ((Capacities<s21::Vector<int, s21::DoublingGrowth<16>>>(40)),
+            (Caps{16, 32, 64}));
+}
+
+TEST(TestVectorGrowthPolicy, OneAndHalf) {
+  using Caps = std::vector<size_t>;
+  ASSERT_EQ((Capacities<s21::Vector<int, s21::OneAndHalfGrowth<>>>(20)),
+            (Caps{1, 2, 3, 4, 6, 9, 13, 19, 28}));
+}
+
+TEST(TestVectorGrowthPolicy, FixedStep) {
+  using Caps = std::vector<size_t>;
+  ASSERT_EQ((Capacities<s21::Vector<int, s21::FixedStepGrowth<8>>>(20)),
+            (Caps{8, 16, 24}));
+  ASSERT_EQ((Capacities<s21::Vector<int, s21::FixedStepGrowth<8, 2>>>(20)),
+            (Caps{8, 16, 24}));
+  ASSERT_EQ((Capacities<s21::Vector<int, s21::FixedStepGrowth<4, 12>>>(20)),
+            (Caps{12, 16, 20}));
+}
+
+TEST(TestVectorGrowthPolicy, PageRounded) {
+  using Policy = s21::PageRoundedGrowth<>;
+  ASSERT_EQ(Policy::Grow(0, 1, sizeof(int)), 4u);  // 16 bytes
+  ASSERT_EQ(Policy::Grow(4, 5, sizeof(int)), 8u);
+  ASSERT_EQ(Policy::Grow(0, 1, 24), 1u);   // 32 bytes hold one 24-byte value
+  ASSERT_EQ(Policy::Grow(1, 2, 24), 2u);   // 64 bytes
+  ASSERT_EQ(Policy::Grow(1000, 1001, 4), 2048u);  // 8000 bytes -> 2 pages
+  ASSERT_EQ(Policy::Grow(1000, 1001, 12), 2048u);  // 24000 -> 24576 bytes
+  s21::Vector<int, Policy> V;
+  for (int i = 0; i < 5000; i++) {
+    V.push_back(i);
+    ASSERT_EQ(V.capacity() * sizeof(int) % 16, 0u);
+  }
+  ASSERT_EQ(V.capacity() * sizeof(int) % 4096, 0u);
+  ASSERT_EQ(V[4999], 4999);
+}
@@ -0,0 +1,153 @@
+#include <benchmark/benchmark.h>
+
+#include <cstring>
+#include <list>
+#include <map>
+#include <memory>
+#include <queue>
+#include <stack>
+#include <string>
+#include <vector>
+
+#include "../List/s21_list.h"
+#include "../Map/s21_map.h"
+#include "../Queue/s21_queue.h"
+#include "../Stack/s21_stack.h"
+#include "../Vector/s21_vector.h"
+
+// A move-only message owning a 4 KiB buffer: moving it is a pointer swap,
+// copying it is impossible, so the containers must move or build in place.
+class Payload {
+ public:
+  static constexpr size_t kSize = 4096;
+
+  explicit Payload(int id) : id_(id), data_(new char[kSize]) {
+    std::memset(data_.get(), id & 0xff, kSize);
+  }
+  Payload(Payload&&) noexcept = default;
+  Payload& operator=(Payload&&) noexcept = default;
+
+  int id() const { return id_; }
+
+ private:
+  int id_;
+  std::unique_ptr<char[]> data_;
+};
+
+// A 1 KiB string: a copy costs an allocation and a memcpy, a move does not.
+static std::string Message(int id) {
+  return std::string(1024, static_cast<char>('a' + id % 26));
+}
+
+// Sequence containers and adapters spell insertion at the end differently.
+template <typename Container, typename... Args>
+static void Emplace(Container& container, Args&&... args) {
+  if constexpr (std::is_same_v<Container, std::list<Payload>> ||
+                std::is_same_v<Container, std::vector<Payload>> ||
+                std::is_same_v<Container, s21::List<Payload>> ||
+                std::is_same_v<Container, s21::Vector<Payload>>) {
+    container.emplace_back(std::forward<Args>(args)...);
+  } else {
+    container.emplace(std::forward<Args>(args)...);
+  }
+}
+
+template <typename Container, typename Value>
+static void Push(Container& container, Value&& value) {
+  if constexpr (std::is_same_v<Container, std::list<std::string>> ||
+                std::is_same_v<Container, std::vector<std::string>> ||
+                std::is_same_v<Container, s21::List<std::string>> ||
+                std::is_same_v<Container, s21::Vector<std::string>>) {
+    container.push_back(std::forward<Value>(value));
+  } else {
+    container.push(std::forward<Value>(value));
+  }
+}
+
+// Build a container of move-only payloads constructed in place.
+template <typename Container>
+static void BM_EmplacePayload(benchmark::State& state) {
+  const int count = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    Container container;
+    for (int i = 0; i < count; ++i) {
+      Emplace(container, i);
+    }
+    benchmark::DoNotOptimize(container);
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+// Push temporaries, which the rvalue overloads move instead of copying.
+template <typename Container>
+static void BM_PushTemporary(benchmark::State& state) {
+  const int count = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    Container container;
+    for (int i = 0; i < count; ++i) {
+      Push(container, Message(i));
+    }
+    benchmark::DoNotOptimize(container);
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+// Map keys to move-only payloads; try_emplace builds the payload in the node.
+template <typename MapType>
+static void BM_MapTryEmplacePayload(benchmark::State& state) {
+  const int count = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    MapType map;
+    for (int i = 0; i < count; ++i) {
+      map.try_emplace(i, i);
+    }
+    benchmark::DoNotOptimize(map);
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+#define S21_EMPLACE_BENCHMARK(bench, container) \
+  BENCHMARK_TEMPLATE(bench, container)          \
+      ->RangeMultiplier(8)                      \
+      ->Range(64, 32768)                        \
+      ->Unit(benchmark::kMicrosecond)
+
+using S21PayloadVector = s21::Vector<Payload>;
+using StdPayloadVector = std::vector<Payload>;
+using S21PayloadList = s21::List<Payload>;
+using StdPayloadList = std::list<Payload>;
+using S21PayloadQueue = s21::Queue<Payload>;
+using StdPayloadQueue = std::queue<Payload>;
+using S21PayloadStack = s21::Stack<Payload>;
+using StdPayloadStack = std::stack<Payload>;
+using S21PayloadMap = s21::Map<int, Payload>;
+using StdPayloadMap = std::map<int, Payload>;
+
+S21_EMPLACE_BENCHMARK(BM_EmplacePayload, S21PayloadVector);
+S21_EMPLACE_BENCHMARK(BM_EmplacePayload, StdPayloadVector);
+S21_EMPLACE_BENCHMARK(BM_EmplacePayload, S21PayloadList);
+S21_EMPLACE_BENCHMARK(BM_EmplacePayload, StdPayloadList);
+S21_EMPLACE_BENCHMARK(BM_EmplacePayload, S21PayloadQueue);
+S21_EMPLACE_BENCHMARK(BM_EmplacePayload, StdPayloadQueue);
+S21_EMPLACE_BENCHMARK(BM_EmplacePayload, S21PayloadStack);
+S21_EMPLACE_BENCHMARK(BM_EmplacePayload, StdPayloadStack);
+S21_EMPLACE_BENCHMARK(BM_MapTryEmplacePayload, S21PayloadMap);
+S21_EMPLACE_BENCHMARK(BM_MapTryEmplacePayload, StdPayloadMap);
+
+using S21StringVector = s21::Vector<std::string>;
+using StdStringVector = std::vector<std::string>;
+using S21StringList = s21::List<std::string>;
+using StdStringList = std::list<std::string>;
+using S21StringQueue = s21::Queue<std::string>;
+using StdStringQueue = std::queue<std::string>;
+using S21StringStack = s21::Stack<std::string>;
+using StdStringStack = std::stack<std::string>;
+
+S21_EMPLACE_BENCHMARK(BM_PushTemporary, S21StringVector);
+S21_EMPLACE_BENCHMARK(BM_PushTemporary, StdStringVector);
+S21_EMPLACE_BENCHMARK(BM_PushTemporary, S21StringList);
+S21_EMPLACE_BENCHMARK(BM_PushTemporary, StdStringList);
+S21_EMPLACE_BENCHMARK(BM_PushTemporary, S21StringQueue);
+S21_EMPLACE_BENCHMARK(BM_PushTemporary, StdStringQueue);
+S21_EMPLACE_BENCHMARK(BM_PushTemporary, S21StringStack);
+S21_EMPLACE_BENCHMARK(BM_PushTemporary, StdStringStack);
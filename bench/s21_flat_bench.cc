@@ -0,0 +1,126 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <map>
+#include <numeric>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "../Flat/s21_flat_map.h"
+#include "../Flat/s21_flat_set.h"
+#include "../Map/s21_map.h"
+#include "../Set/s21_set.h"
+
+using S21FlatMap = s21::FlatMap<int, int>;
+using S21Map = s21::Map<int, int>;
+using StdMap = std::map<int, int>;
+using S21FlatSet = s21::FlatSet<int>;
+using S21Set = s21::Set<int>;
+
+// Every container is built once from the sorted keys 0..count-1, the way a
+// lookup table is loaded, and then only read.
+template <typename Container>
+static Container MakeTable(int count) {
+  if constexpr (std::is_same_v<Container, StdMap>) {
+    StdMap map;
+    for (int key = 0; key < count; ++key) {
+      map.emplace_hint(map.end(), key, key);
+    }
+    return map;
+  } else if constexpr (std::is_same_v<Container, S21FlatSet> ||
+                       std::is_same_v<Container, S21Set>) {
+    std::vector<int> keys(count);
+    std::iota(keys.begin(), keys.end(), 0);
+    return Container::from_sorted(keys.begin(), keys.end());
+  } else {
+    std::vector<std::pair<int, int>> pairs(count);
+    for (int key = 0; key < count; ++key) {
+      pairs[key] = {key, key};
+    }
+    return Container::from_sorted(pairs.begin(), pairs.end());
+  }
+}
+
+static bool Contains(StdMap& map, int key) { return map.count(key); }
+template <typename Container>
+static bool Contains(Container& container, int key) {
+  return container.contains(key);
+}
+
+// Sums what an iteration yields: the mapped values of a map, the keys of a
+// set.
+static long Sum(S21FlatMap& map) {
+  long sum = 0;
+  for (auto it = map.cbegin(); it != map.cend(); ++it) {
+    sum += it.value();
+  }
+  return sum;
+}
+static long Sum(S21Map& map) {
+  long sum = 0;
+  for (auto it = map.cbegin(); it != map.cend(); ++it) {
+    sum += it.node()->value_;
+  }
+  return sum;
+}
+static long Sum(StdMap& map) {
+  long sum = 0;
+  for (const auto& [key, value] : map) {
+    sum += value;
+  }
+  return sum;
+}
+template <typename SetType>
+static long Sum(SetType& set) {
+  long sum = 0;
+  for (auto it = set.cbegin(); it != set.cend(); ++it) {
+    sum += *it;
+  }
+  return sum;
+}
+
+// Looks up random keys that are all present.
+template <typename Container>
+static void BM_FlatFind(benchmark::State& state) {
+  const int count = static_cast<int>(state.range(0));
+  Container table = MakeTable<Container>(count);
+  std::vector<int> probes(1 << 16);
+  std::mt19937 gen(42);
+  for (int& key : probes) {
+    key = static_cast<int>(gen() % count);
+  }
+  for (auto _ : state) {
+    for (int key : probes) {
+      benchmark::DoNotOptimize(Contains(table, key));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * probes.size());
+}
+
+template <typename Container>
+static void BM_FlatIterate(benchmark::State& state) {
+  const int count = static_cast<int>(state.range(0));
+  Container table = MakeTable<Container>(count);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(Sum(table));
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+#define S21_FLAT_BENCHMARK(bench, container) \
+  BENCHMARK_TEMPLATE(bench, container)       \
+      ->RangeMultiplier(10)                  \
+      ->Range(1000, 10000000)                \
+      ->Unit(benchmark::kMicrosecond)
+
+S21_FLAT_BENCHMARK(BM_FlatFind, S21FlatMap);
+S21_FLAT_BENCHMARK(BM_FlatFind, S21Map);
+S21_FLAT_BENCHMARK(BM_FlatFind, StdMap);
+S21_FLAT_BENCHMARK(BM_FlatFind, S21FlatSet);
+S21_FLAT_BENCHMARK(BM_FlatFind, S21Set);
+S21_FLAT_BENCHMARK(BM_FlatIterate, S21FlatMap);
+S21_FLAT_BENCHMARK(BM_FlatIterate, S21Map);
+S21_FLAT_BENCHMARK(BM_FlatIterate, StdMap);
+S21_FLAT_BENCHMARK(BM_FlatIterate, S21FlatSet);
+S21_FLAT_BENCHMARK(BM_FlatIterate, S21Set);
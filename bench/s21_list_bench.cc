@@ -0,0 +1,179 @@
+#include <benchmark/benchmark.h>
+
+#include <list>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "../List/s21_list.h"
+
+static std::vector<int> RandomValues(size_t count, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::vector<int> values(count);
+  for (int& value : values) {
+    value = static_cast<int>(gen());
+  }
+  return values;
+}
+
+// A 128-byte record sorted by its key: moving payloads around would cost
+// far more than relinking nodes.
+struct Record {
+  explicit Record(int k) : key(k), payload{} {}
+  bool operator<(const Record& other) const { return key < other.key; }
+
+  int key;
+  char payload[124];
+};
+
+// s21::List allocating every node from the heap, for comparison with the
+// default node pool
+using HeapList = s21::List<int, std::allocator<int>>;
+
+template <typename ListType>
+static ListType MakeList(const std::vector<int>& values) {
+  ListType list;
+  for (int value : values) {
+    list.emplace_back(value);
+  }
+  return list;
+}
+
+// s21::List spells it c_begin()
+static s21::List<int>::const_iterator ConstBegin(const s21::List<int>& list) {
+  return list.c_begin();
+}
+
+static std::list<int>::const_iterator ConstBegin(const std::list<int>& list) {
+  return list.cbegin();
+}
+
+template <typename ListType>
+static void BM_ListPushBack(benchmark::State& state) {
+  const int count = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    ListType list;
+    for (int i = 0; i < count; ++i) {
+      list.push_back(i);
+    }
+    benchmark::DoNotOptimize(list.size());
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+// Keep the list at a constant length and push and pop at both ends, the
+// pattern of a List-backed Stack or Queue.
+template <typename ListType>
+static void BM_ListChurn(benchmark::State& state) {
+  const int depth = static_cast<int>(state.range(0));
+  ListType list;
+  for (int i = 0; i < depth; ++i) {
+    list.push_back(i);
+  }
+  int value = 0;
+  for (auto _ : state) {
+    list.push_front(value++);
+    list.pop_back();
+    benchmark::DoNotOptimize(list.front());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Time only the destruction of a list of state.range(0) nodes.
+template <typename ListType>
+static void BM_ListDestroy(benchmark::State& state) {
+  const int count = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto list = std::make_unique<ListType>();
+    for (int i = 0; i < count; ++i) {
+      list->push_back(i);
+    }
+    state.ResumeTiming();
+    list.reset();
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+template <typename ListType>
+static void BM_ListSort(benchmark::State& state) {
+  const auto values = RandomValues(state.range(0), 42);
+  for (auto _ : state) {
+    state.PauseTiming();
+    ListType list = MakeList<ListType>(values);
+    state.ResumeTiming();
+    list.sort();
+    benchmark::DoNotOptimize(list.size());
+  }
+  state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+// Merges two sorted lists of state.range(0) elements each.
+template <typename ListType>
+static void BM_ListMerge(benchmark::State& state) {
+  const auto left = RandomValues(state.range(0), 1);
+  const auto right = RandomValues(state.range(0), 2);
+  for (auto _ : state) {
+    state.PauseTiming();
+    ListType first = MakeList<ListType>(left);
+    ListType second = MakeList<ListType>(right);
+    first.sort();
+    second.sort();
+    state.ResumeTiming();
+    first.merge(second);
+    benchmark::DoNotOptimize(first.size());
+  }
+  state.SetItemsProcessed(state.iterations() * left.size() * 2);
+}
+
+template <typename ListType>
+static void BM_ListSplice(benchmark::State& state) {
+  const auto values = RandomValues(state.range(0), 42);
+  for (auto _ : state) {
+    state.PauseTiming();
+    ListType first = MakeList<ListType>(values);
+    ListType second = MakeList<ListType>(values);
+    state.ResumeTiming();
+    first.splice(ConstBegin(first), second);
+    benchmark::DoNotOptimize(first.size());
+  }
+}
+
+BENCHMARK_TEMPLATE(BM_ListPushBack, s21::List<int>)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_ListPushBack, std::list<int>)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_ListPushBack, HeapList)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_ListChurn, s21::List<int>)->Range(1 << 4, 1 << 16);
+BENCHMARK_TEMPLATE(BM_ListChurn, std::list<int>)->Range(1 << 4, 1 << 16);
+BENCHMARK_TEMPLATE(BM_ListChurn, HeapList)->Range(1 << 4, 1 << 16);
+BENCHMARK_TEMPLATE(BM_ListDestroy, s21::List<int>)
+    ->Arg(10000000)
+    ->Unit(benchmark::kMillisecond)
+    ->Iterations(3);
+BENCHMARK_TEMPLATE(BM_ListDestroy, std::list<int>)
+    ->Arg(10000000)
+    ->Unit(benchmark::kMillisecond)
+    ->Iterations(3);
+BENCHMARK_TEMPLATE(BM_ListDestroy, HeapList)
+    ->Arg(10000000)
+    ->Unit(benchmark::kMillisecond)
+    ->Iterations(3);
+BENCHMARK_TEMPLATE(BM_ListSort, s21::List<int>)
+    ->Range(1 << 6, 1 << 20)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_ListSort, std::list<int>)
+    ->Range(1 << 6, 1 << 20)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_ListSort, s21::List<Record>)
+    ->Range(1 << 6, 1 << 20)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_ListSort, std::list<Record>)
+    ->Range(1 << 6, 1 << 20)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_ListMerge, s21::List<int>)
+    ->Range(1 << 6, 1 << 20)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_ListMerge, std::list<int>)
+    ->Range(1 << 6, 1 << 20)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_ListSplice, s21::List<int>)->Range(1 << 6, 1 << 12);
+BENCHMARK_TEMPLATE(BM_ListSplice, std::list<int>)->Range(1 << 6, 1 << 12);
@@ -0,0 +1,275 @@
+#include <benchmark/benchmark.h>
+#include <malloc.h>
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "../Map/s21_map.h"
+#include "../Set/s21_set.h"
+
+using S21Map = s21::Map<int, int>;
+using S21HeapMap = s21::Map<int, int, std::less<int>,
+                            std::allocator<std::pair<const int, int>>>;
+using StdMap = std::map<int, int>;
+using S21Set = s21::Set<int>;
+using S21IndexedSet = s21::IndexedSet<int>;
+using StdSet = std::set<int>;
+using S21StringSet = s21::Set<std::string>;
+using StdStringSet = std::set<std::string>;
+
+static std::vector<int> RandomKeys(size_t count) {
+  std::vector<int> keys(count);
+  std::iota(keys.begin(), keys.end(), 0);
+  std::shuffle(keys.begin(), keys.end(), std::mt19937(42));
+  return keys;
+}
+
+// The two libraries spell insertion, lookup and iteration differently.
+static void Insert(S21Map& map, int key) { map.insert(key, key); }
+static void Insert(S21HeapMap& map, int key) { map.insert(key, key); }
+static void Insert(StdMap& map, int key) { map.emplace(key, key); }
+template <typename SetType>
+static void Insert(SetType& set, int key) {
+  set.insert(key);
+}
+
+static bool Contains(S21Map& map, int key) { return map.contains(key); }
+static bool Contains(StdMap& map, int key) { return map.count(key); }
+template <typename SetType>
+static bool Contains(SetType& set, int key) {
+  return set.find(key) != set.end();
+}
+
+template <typename Container>
+static void Erase(Container& container, int key) {
+  container.erase(key);
+}
+
+static int Largest(S21Set& set) { return *set.max(); }
+static int Largest(StdSet& set) { return *set.rbegin(); }
+
+// Order statistics: the indexed set walks between the root and one node,
+// std::set walks from begin().
+static int Nth(S21IndexedSet& set, size_t pos) { return *set.nth(pos); }
+static int Nth(StdSet& set, size_t pos) { return *std::next(set.begin(), pos); }
+
+static size_t Rank(S21IndexedSet& set, int key) { return set.rank(key); }
+static size_t Rank(StdSet& set, int key) {
+  return std::distance(set.begin(), set.lower_bound(key));
+}
+
+static int KeyOf(int key) { return key; }
+static int KeyOf(const StdMap::value_type& value) { return value.first; }
+
+template <typename Container>
+static Container MakeContainer(const std::vector<int>& keys) {
+  Container container;
+  for (int key : keys) {
+    Insert(container, key);
+  }
+  return container;
+}
+
+template <typename Container>
+static void BM_AssociativeInsert(benchmark::State& state) {
+  const auto keys = RandomKeys(state.range(0));
+  for (auto _ : state) {
+    Container container = MakeContainer<Container>(keys);
+    benchmark::DoNotOptimize(container.size());
+  }
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+// Bytes taken from the heap (glibc), slabs and malloc overhead included.
+static size_t HeapInUse() {
+  struct mallinfo2 info = mallinfo2();
+  return info.uordblks + info.hblkhd;
+}
+
+// Also reports how much heap the container takes per key.
+template <typename Container>
+static void BM_AssociativeFind(benchmark::State& state) {
+  const auto keys = RandomKeys(state.range(0));
+  size_t heap_before = HeapInUse();
+  Container container = MakeContainer<Container>(keys);
+  state.counters["bytes_per_key"] =
+      static_cast<double>(HeapInUse() - heap_before) / keys.size();
+  for (auto _ : state) {
+    for (int key : keys) {
+      benchmark::DoNotOptimize(Contains(container, key));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+template <typename Container>
+static void BM_AssociativeErase(benchmark::State& state) {
+  const auto keys = RandomKeys(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    Container container = MakeContainer<Container>(keys);
+    state.ResumeTiming();
+    for (int key : keys) {
+      Erase(container, key);
+    }
+    benchmark::DoNotOptimize(container.size());
+  }
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+template <typename Container>
+static void BM_AssociativeIterate(benchmark::State& state) {
+  const auto keys = RandomKeys(state.range(0));
+  Container container = MakeContainer<Container>(keys);
+  for (auto _ : state) {
+    long sum = 0;
+    for (auto it = container.begin(); it != container.end(); ++it) {
+      sum += KeyOf(*it);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+// Copy construction alone; the copy is destroyed outside the timing.
+template <typename Container>
+static void BM_AssociativeCopy(benchmark::State& state) {
+  const auto source = MakeContainer<Container>(RandomKeys(state.range(0)));
+  for (auto _ : state) {
+    auto copy = std::make_unique<Container>(source);
+    benchmark::DoNotOptimize(copy->size());
+    state.PauseTiming();
+    copy.reset();
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * source.size());
+}
+
+template <typename Container>
+static void BM_AssociativeDestroy(benchmark::State& state) {
+  const auto source = MakeContainer<Container>(RandomKeys(state.range(0)));
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto copy = std::make_unique<Container>(source);
+    state.ResumeTiming();
+    copy.reset();
+  }
+  state.SetItemsProcessed(state.iterations() * source.size());
+}
+
+// What a loop that keeps asking for the current minimum and maximum pays.
+// The keys are a permutation of 0..n-1, so they double as positions. A few
+// probes are enough, the walks of std::set are long.
+constexpr size_t kOrderProbes = 64;
+
+template <typename SetType>
+static void BM_AssociativeNth(benchmark::State& state) {
+  const auto keys = RandomKeys(state.range(0));
+  SetType set = MakeContainer<SetType>(keys);
+  for (auto _ : state) {
+    for (size_t i = 0; i < kOrderProbes; ++i) {
+      benchmark::DoNotOptimize(Nth(set, keys[i]));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kOrderProbes);
+}
+
+template <typename SetType>
+static void BM_AssociativeRank(benchmark::State& state) {
+  const auto keys = RandomKeys(state.range(0));
+  SetType set = MakeContainer<SetType>(keys);
+  for (auto _ : state) {
+    for (size_t i = 0; i < kOrderProbes; ++i) {
+      benchmark::DoNotOptimize(Rank(set, keys[i]));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kOrderProbes);
+}
+
+template <typename SetType>
+static void BM_AssociativeBeginMax(benchmark::State& state) {
+  SetType set = MakeContainer<SetType>(RandomKeys(state.range(0)));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(*set.begin());
+    benchmark::DoNotOptimize(Largest(set));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Keys share a long prefix, as paths or URLs do, so every comparison has to
+// scan it before the keys differ.
+template <typename SetType>
+static void BM_AssociativeFindLongKey(benchmark::State& state) {
+  std::vector<std::string> keys;
+  for (int key : RandomKeys(state.range(0))) {
+    keys.push_back(std::string(48, '/') + std::to_string(key));
+  }
+  SetType set;
+  for (const auto& key : keys) {
+    set.insert(key);
+  }
+  for (auto _ : state) {
+    for (const auto& key : keys) {
+      benchmark::DoNotOptimize(set.find(key) != set.end());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+#define S21_ASSOCIATIVE_BENCHMARK(bench, type) \
+  BENCHMARK_TEMPLATE(bench, type)              \
+      ->Range(1 << 10, 1 << 20)                \
+      ->Unit(benchmark::kMicrosecond)
+
+S21_ASSOCIATIVE_BENCHMARK(BM_AssociativeInsert, S21Map);
+S21_ASSOCIATIVE_BENCHMARK(BM_AssociativeInsert, StdMap);
+S21_ASSOCIATIVE_BENCHMARK(BM_AssociativeInsert, S21Set);
+S21_ASSOCIATIVE_BENCHMARK(BM_AssociativeInsert, StdSet);
+S21_ASSOCIATIVE_BENCHMARK(BM_AssociativeInsert, S21IndexedSet);
+S21_ASSOCIATIVE_BENCHMARK(BM_AssociativeFind, S21Map);
+S21_ASSOCIATIVE_BENCHMARK(BM_AssociativeFind, StdMap);
+S21_ASSOCIATIVE_BENCHMARK(BM_AssociativeFind, S21Set);
+S21_ASSOCIATIVE_BENCHMARK(BM_AssociativeFind, StdSet);
+S21_ASSOCIATIVE_BENCHMARK(BM_AssociativeFindLongKey, S21StringSet);
+S21_ASSOCIATIVE_BENCHMARK(BM_AssociativeFindLongKey, StdStringSet);
+S21_ASSOCIATIVE_BENCHMARK(BM_AssociativeErase, S21Map);
+S21_ASSOCIATIVE_BENCHMARK(BM_AssociativeErase, StdMap);
+S21_ASSOCIATIVE_BENCHMARK(BM_AssociativeErase, S21Set);
+S21_ASSOCIATIVE_BENCHMARK(BM_AssociativeErase, StdSet);
+S21_ASSOCIATIVE_BENCHMARK(BM_AssociativeErase, S21IndexedSet);
+S21_ASSOCIATIVE_BENCHMARK(BM_AssociativeNth, S21IndexedSet);
+S21_ASSOCIATIVE_BENCHMARK(BM_AssociativeNth, StdSet);
+S21_ASSOCIATIVE_BENCHMARK(BM_AssociativeRank, S21IndexedSet);
+S21_ASSOCIATIVE_BENCHMARK(BM_AssociativeRank, StdSet);
+S21_ASSOCIATIVE_BENCHMARK(BM_AssociativeCopy, S21Map);
+S21_ASSOCIATIVE_BENCHMARK(BM_AssociativeCopy, S21HeapMap);
+S21_ASSOCIATIVE_BENCHMARK(BM_AssociativeCopy, StdMap);
+S21_ASSOCIATIVE_BENCHMARK(BM_AssociativeDestroy, S21Map);
+S21_ASSOCIATIVE_BENCHMARK(BM_AssociativeDestroy, S21HeapMap);
+S21_ASSOCIATIVE_BENCHMARK(BM_AssociativeDestroy, StdMap);
+S21_ASSOCIATIVE_BENCHMARK(BM_AssociativeBeginMax, S21Set);
+S21_ASSOCIATIVE_BENCHMARK(BM_AssociativeBeginMax, StdSet);
+S21_ASSOCIATIVE_BENCHMARK(BM_AssociativeIterate, S21Map);
+S21_ASSOCIATIVE_BENCHMARK(BM_AssociativeIterate, StdMap);
+S21_ASSOCIATIVE_BENCHMARK(BM_AssociativeIterate, S21Set);
+S21_ASSOCIATIVE_BENCHMARK(BM_AssociativeIterate, StdSet);
+
+// Lookups and a full in-order scan of a set far larger than the cache.
+BENCHMARK_TEMPLATE(BM_AssociativeFind, S21Set)
+    ->Arg(10'000'000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_AssociativeFind, StdSet)
+    ->Arg(10'000'000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_AssociativeIterate, S21Set)
+    ->Arg(10'000'000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_AssociativeIterate, StdSet)
+    ->Arg(10'000'000)
+    ->Unit(benchmark::kMillisecond);
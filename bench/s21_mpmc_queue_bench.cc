@@ -0,0 +1,54 @@
+#include <benchmark/benchmark.h>
+
+#include <mutex>
+
+#include "../Queue/s21_mpmc_queue.h"
+#include "../Queue/s21_queue.h"
+
+// Every benchmark thread pushes one item and pops one item per iteration on a
+// single shared queue, so adding threads only adds contention.
+static s21::MpmcQueue<int> bounded_queue(1 << 16);
+static s21::SegmentedMpmcQueue<int> segmented_queue;
+
+template <typename Queue>
+static void BM_ConcurrentPushPop(benchmark::State& state, Queue& queue) {
+  int value = static_cast<int>(state.thread_index());
+  for (auto _ : state) {
+    queue.push(value);
+    while (!queue.try_pop(value)) {
+    }
+    benchmark::DoNotOptimize(value);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_MpmcBounded(benchmark::State& state) {
+  BM_ConcurrentPushPop(state, bounded_queue);
+}
+
+static void BM_MpmcSegmented(benchmark::State& state) {
+  BM_ConcurrentPushPop(state, segmented_queue);
+}
+
+static void BM_MutexQueue(benchmark::State& state) {
+  static s21::Queue<int> queue;
+  static std::mutex mutex;
+  int value = static_cast<int>(state.thread_index());
+  for (auto _ : state) {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      queue.push(value);
+    }
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      value = queue.front();
+      queue.pop();
+    }
+    benchmark::DoNotOptimize(value);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_MpmcBounded)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK(BM_MpmcSegmented)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK(BM_MutexQueue)->ThreadRange(1, 16)->UseRealTime();
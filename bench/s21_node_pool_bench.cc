@@ -0,0 +1,98 @@
+#include <benchmark/benchmark.h>
+
+#include <malloc.h>
+
+#include <memory>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "../Map/s21_map.h"
+
+using PoolMap = s21::Map<int, int>;
+using HeapMap = s21::Map<int, int, std::less<int>,
+                         std::allocator<std::pair<const int, int>>>;
+
+static std::vector<int> ShuffledKeys(size_t count) {
+  std::vector<int> keys(count);
+  std::iota(keys.begin(), keys.end(), 0);
+  std::shuffle(keys.begin(), keys.end(), std::mt19937(42));
+  return keys;
+}
+
+// Bytes currently handed out by malloc, including mmap-ed chunks. Unlike RSS
+// this does not depend on what earlier benchmarks left in the malloc arenas.
+static double HeapBytes() {
+  struct mallinfo2 info = mallinfo2();
+  return static_cast<double>(info.uordblks + info.hblkhd);
+}
+
+template <typename MapType>
+static void BM_MapInsert(benchmark::State& state) {
+  const auto keys = ShuffledKeys(state.range(0));
+  double heap = 0;
+  for (auto _ : state) {
+    double before = HeapBytes();
+    MapType map;
+    for (int key : keys) {
+      map.insert(key, key);
+    }
+    heap = HeapBytes() - before;
+    state.PauseTiming();
+    map.clear();
+    state.ResumeTiming();
+  }
+  state.counters["heap_bytes_per_key"] = heap / keys.size();
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+template <typename MapType>
+static void BM_MapErase(benchmark::State& state) {
+  const auto keys = ShuffledKeys(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    MapType map;
+    for (int key : keys) {
+      map.insert(key, key);
+    }
+    state.ResumeTiming();
+    // Map only exposes erase(iterator); erase by key lives in the tree
+    typename MapType::Base& tree = map;
+    for (int key : keys) {
+      tree.erase(key);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+template <typename MapType>
+static void BM_MapClear(benchmark::State& state) {
+  const auto keys = ShuffledKeys(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    MapType map;
+    for (int key : keys) {
+      map.insert(key, key);
+    }
+    state.ResumeTiming();
+    map.clear();
+  }
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+// Every iteration builds a whole map, so a few iterations are plenty.
+#define S21_MAP_BENCH(func)            \
+  BENCHMARK_TEMPLATE(func, PoolMap)    \
+      ->RangeMultiplier(10)            \
+      ->Range(100000, 10000000)        \
+      ->Iterations(3)                  \
+      ->Unit(benchmark::kMillisecond); \
+  BENCHMARK_TEMPLATE(func, HeapMap)    \
+      ->RangeMultiplier(10)            \
+      ->Range(100000, 10000000)        \
+      ->Iterations(3)                  \
+      ->Unit(benchmark::kMillisecond)
+
+S21_MAP_BENCH(BM_MapInsert);
+S21_MAP_BENCH(BM_MapErase);
+S21_MAP_BENCH(BM_MapClear);
@@ -0,0 +1,55 @@
+#include <benchmark/benchmark.h>
+
+#include <queue>
+
+#include "../Queue/s21_queue.h"
+
+// Fill the queue to the given depth and drain it again, so the cost per
+// element shows whether push/pop stay flat as the backlog grows.
+template <typename Queue>
+static void BM_QueueFillDrain(benchmark::State& state) {
+  const int depth = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    Queue queue;
+    for (int i = 0; i < depth; ++i) {
+      queue.push(i);
+    }
+    while (!queue.empty()) {
+      benchmark::DoNotOptimize(queue.front());
+      queue.pop();
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * depth);
+}
+
+// Keep the queue at a constant depth and cycle one element through it.
+template <typename Queue>
+static void BM_QueueSteadyState(benchmark::State& state) {
+  const int depth = static_cast<int>(state.range(0));
+  Queue queue;
+  for (int i = 0; i < depth; ++i) {
+    queue.push(i);
+  }
+  int value = 0;
+  for (auto _ : state) {
+    queue.push(value++);
+    benchmark::DoNotOptimize(queue.front());
+    queue.pop();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_TEMPLATE(BM_QueueFillDrain, s21::Queue<int>)
+    ->RangeMultiplier(10)
+    ->Range(10, 10000000)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_QueueFillDrain, std::queue<int>)
+    ->RangeMultiplier(10)
+    ->Range(10, 10000000)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_QueueSteadyState, s21::Queue<int>)
+    ->RangeMultiplier(10)
+    ->Range(10, 10000000);
+BENCHMARK_TEMPLATE(BM_QueueSteadyState, std::queue<int>)
+    ->RangeMultiplier(10)
+    ->Range(10, 10000000);
@@ -0,0 +1,54 @@
+#include <benchmark/benchmark.h>
+
+#include <numeric>
+#include <set>
+#include <vector>
+
+#include "../Set/s21_set.h"
+
+// Cold start: load state.range(0) sorted keys into an empty set.
+static std::vector<int> SortedKeys(size_t count) {
+  std::vector<int> keys(count);
+  std::iota(keys.begin(), keys.end(), 0);
+  return keys;
+}
+
+static void BM_SetFromSorted(benchmark::State& state) {
+  const auto keys = SortedKeys(state.range(0));
+  for (auto _ : state) {
+    auto set = s21::Set<int>::from_sorted(keys.begin(), keys.end());
+    benchmark::DoNotOptimize(set);
+  }
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+static void BM_SetInsertSorted(benchmark::State& state) {
+  const auto keys = SortedKeys(state.range(0));
+  for (auto _ : state) {
+    s21::Set<int> set;
+    for (int key : keys) {
+      set.insert(key);
+    }
+    benchmark::DoNotOptimize(set);
+  }
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+static void BM_StdSetFromSorted(benchmark::State& state) {
+  const auto keys = SortedKeys(state.range(0));
+  for (auto _ : state) {
+    std::set<int> set(keys.begin(), keys.end());
+    benchmark::DoNotOptimize(set);
+  }
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+BENCHMARK(BM_SetFromSorted)
+    ->Range(1 << 10, 1 << 22)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_SetInsertSorted)
+    ->Range(1 << 10, 1 << 22)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_StdSetFromSorted)
+    ->Range(1 << 10, 1 << 22)
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,56 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "../Map/s21_map.h"
+#include "../Set/s21_set.h"
+
+// state.range(0) inserts where only one key in five is new, like a
+// deduplicating ingest stream.
+static std::vector<int> DuplicateHeavyKeys(size_t count) {
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<int> dist(0, static_cast<int>(count / 5));
+  std::vector<int> keys(count);
+  for (int& key : keys) {
+    key = dist(gen);
+  }
+  return keys;
+}
+
+template <typename SetType>
+static void BM_InsertDuplicateHeavy(benchmark::State& state) {
+  const auto keys = DuplicateHeavyKeys(state.range(0));
+  for (auto _ : state) {
+    SetType set;
+    for (int key : keys) {
+      benchmark::DoNotOptimize(set.insert(key));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+template <typename MapType>
+static void BM_MapInsertDuplicateHeavy(benchmark::State& state) {
+  const auto keys = DuplicateHeavyKeys(state.range(0));
+  const std::string payload(32, 'x');
+  for (auto _ : state) {
+    MapType map;
+    for (int key : keys) {
+      benchmark::DoNotOptimize(map.insert({key, payload}));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+BENCHMARK_TEMPLATE(BM_InsertDuplicateHeavy, s21::Set<int>)
+    ->Range(1 << 10, 1 << 20)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_InsertDuplicateHeavy, std::set<int>)
+    ->Range(1 << 10, 1 << 20)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_MapInsertDuplicateHeavy, s21::Map<int, std::string>)
+    ->Range(1 << 10, 1 << 20)
+    ->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,66 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <set>
+#include <vector>
+
+#include "../Set/s21_set.h"
+
+// A global set of state.range(0) keys absorbs a shard of random keys
+// state.range(1) times smaller, a tenth of them already in the global set.
+struct MergeInput {
+  std::vector<int> global;
+  std::vector<int> shard;
+};
+
+static MergeInput MakeMergeInput(size_t count, size_t ratio) {
+  MergeInput res;
+  std::mt19937 gen(42);
+  for (size_t i = 0; i < count; ++i) {
+    res.global.push_back(static_cast<int>(i * 2));
+  }
+  std::uniform_int_distribution<int> dist(0, static_cast<int>(count * 2));
+  for (size_t i = 0; i < count / ratio; ++i) {
+    int key = dist(gen);
+    res.shard.push_back(i % 10 ? key | 1 : key & ~1);
+  }
+  return res;
+}
+
+template <typename SetType>
+static void BM_MergeShard(benchmark::State& state) {
+  const MergeInput input = MakeMergeInput(state.range(0), state.range(1));
+  for (auto _ : state) {
+    state.PauseTiming();
+    SetType global(input.global.begin(), input.global.end());
+    SetType shard(input.shard.begin(), input.shard.end());
+    state.ResumeTiming();
+    global.merge(shard);
+    benchmark::DoNotOptimize(global);
+    state.PauseTiming();
+    global.clear();
+    shard.clear();
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * input.shard.size());
+}
+
+// s21::Set has no range constructor; from_sorted needs sorted input.
+template <typename Key>
+struct RangeSet : s21::Set<Key> {
+  template <typename It>
+  RangeSet(It first, It last) {
+    for (; first != last; ++first) {
+      this->insert(*first);
+    }
+  }
+};
+
+BENCHMARK_TEMPLATE(BM_MergeShard, RangeSet<int>)
+    ->ArgsProduct({{1 << 12, 1 << 16, 1 << 20}, {1, 4, 8, 64}})
+    ->Iterations(10)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_MergeShard, std::set<int>)
+    ->ArgsProduct({{1 << 12, 1 << 16, 1 << 20}, {1, 4, 8, 64}})
+    ->Iterations(10)
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,64 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include "../SmallVector/s21_small_vector.h"
+#include "../Vector/s21_vector.h"
+
+// Creates and destroys a short vector per iteration, the pattern of
+// temporaries such as per-node child lists or a few tokens per line.
+template <typename VectorType>
+static void BM_ShortVectorLifetime(benchmark::State& state) {
+  const int count = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    VectorType vector;
+    for (int i = 0; i < count; ++i) {
+      vector.push_back(i);
+    }
+    benchmark::DoNotOptimize(vector.data());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Keeps a million short vectors alive at once and sums them, so the cost of
+// one heap block per vector shows up in both allocation and cache misses.
+template <typename VectorType>
+static void BM_ManyShortVectors(benchmark::State& state) {
+  const int count = static_cast<int>(state.range(0));
+  constexpr int kVectors = 1 << 20;
+  for (auto _ : state) {
+    std::vector<VectorType> vectors(kVectors);
+    for (auto& vector : vectors) {
+      for (int i = 0; i < count; ++i) {
+        vector.push_back(i);
+      }
+    }
+    long sum = 0;
+    for (auto& vector : vectors) {
+      for (auto it = vector.begin(); it != vector.end(); ++it) {
+        sum += *it;
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * kVectors);
+}
+
+using S21Vector = s21::Vector<int>;
+using S21SmallVector = s21::SmallVector<int, 8>;
+using StdVector = std::vector<int>;
+
+// Sizes up to 8 stay inline, 16 makes the small vector spill to the heap.
+BENCHMARK_TEMPLATE(BM_ShortVectorLifetime, S21Vector)
+    ->Arg(1)->Arg(4)->Arg(8)->Arg(16);
+BENCHMARK_TEMPLATE(BM_ShortVectorLifetime, S21SmallVector)
+    ->Arg(1)->Arg(4)->Arg(8)->Arg(16);
+BENCHMARK_TEMPLATE(BM_ShortVectorLifetime, StdVector)
+    ->Arg(1)->Arg(4)->Arg(8)->Arg(16);
+BENCHMARK_TEMPLATE(BM_ManyShortVectors, S21Vector)
+    ->Arg(4)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_ManyShortVectors, S21SmallVector)
+    ->Arg(4)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_ManyShortVectors, StdVector)
+    ->Arg(4)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,138 @@
+#include <benchmark/benchmark.h>
+
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../Queue/s21_queue.h"
+#include "../Queue/s21_spsc_queue.h"
+
+// Producer pushes state.range(0) items from its own thread while the benchmark
+// thread consumes them. The mutex-wrapped s21::Queue is the baseline the
+// SPSC queue replaces.
+static void BM_SpscThroughput(benchmark::State& state) {
+  const int count = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    s21::SpscQueue<int, 4096> queue;
+    std::thread producer([&queue, count] {
+      for (int i = 0; i < count; ++i) {
+        while (!queue.try_push(i)) {
+          std::this_thread::yield();
+        }
+      }
+    });
+    int value = 0;
+    for (int received = 0; received < count;) {
+      if (queue.try_pop(value)) {
+        ++received;
+      } else {
+        std::this_thread::yield();
+      }
+    }
+    benchmark::DoNotOptimize(value);
+    producer.join();
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+static void BM_SpscBatchThroughput(benchmark::State& state) {
+  const int count = static_cast<int>(state.range(0));
+  constexpr size_t kBatch = 64;
+  for (auto _ : state) {
+    s21::SpscQueue<int, 4096> queue;
+    std::thread producer([&queue, count] {
+      std::vector<int> batch(kBatch);
+      for (int i = 0; i < count; i += kBatch) {
+        size_t sent = 0;
+        while (sent < kBatch) {
+          size_t n = queue.try_push_n(batch.data() + sent, kBatch - sent);
+          if (!n) std::this_thread::yield();
+          sent += n;
+        }
+      }
+    });
+    std::vector<int> batch(kBatch);
+    for (int received = 0; received < count;) {
+      size_t n = queue.try_pop_n(batch.data(), kBatch);
+      if (!n) std::this_thread::yield();
+      received += static_cast<int>(n);
+    }
+    benchmark::DoNotOptimize(batch.data());
+    producer.join();
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+static void BM_MutexQueueThroughput(benchmark::State& state) {
+  const int count = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    s21::Queue<int> queue;
+    std::mutex mutex;
+    std::thread producer([&queue, &mutex, count] {
+      for (int i = 0; i < count; ++i) {
+        std::lock_guard<std::mutex> lock(mutex);
+        queue.push(i);
+      }
+    });
+    int value = 0;
+    for (int received = 0; received < count;) {
+      std::unique_lock<std::mutex> lock(mutex);
+      if (!queue.empty()) {
+        value = queue.front();
+        queue.pop();
+        ++received;
+      } else {
+        lock.unlock();
+        std::this_thread::yield();
+      }
+    }
+    benchmark::DoNotOptimize(value);
+    producer.join();
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+// Round trip of one message through a pair of queues; the time per iteration
+// is twice the one-way handoff latency.
+static void BM_SpscPingPong(benchmark::State& state) {
+  s21::SpscQueue<int, 64> ping;
+  s21::SpscQueue<int, 64> pong;
+  std::thread echo([&ping, &pong] {
+    int value = 0;
+    do {
+      while (!ping.try_pop(value)) {
+        std::this_thread::yield();
+      }
+      while (!pong.try_push(value)) {
+        std::this_thread::yield();
+      }
+    } while (value >= 0);
+  });
+  int value = 0;
+  for (auto _ : state) {
+    ping.try_push(value);
+    while (!pong.try_pop(value)) {
+      std::this_thread::yield();
+    }
+    ++value;
+  }
+  ping.try_push(-1);
+  while (!pong.try_pop(value)) {
+    std::this_thread::yield();
+  }
+  echo.join();
+}
+
+BENCHMARK(BM_SpscThroughput)
+    ->Arg(1 << 20)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK(BM_SpscBatchThroughput)
+    ->Arg(1 << 20)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK(BM_MutexQueueThroughput)
+    ->Arg(1 << 20)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK(BM_SpscPingPong)->UseRealTime();
@@ -0,0 +1,66 @@
+#include <benchmark/benchmark.h>
+
+#include <deque>
+#include <memory>
+#include <stack>
+
+#include "../Stack/s21_stack.h"
+
+// Fill the stack to the given depth and drain it again.
+template <typename StackType>
+static void BM_StackFillDrain(benchmark::State& state) {
+  const int depth = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    StackType stack;
+    for (int i = 0; i < depth; ++i) {
+      stack.push(i);
+    }
+    while (!stack.empty()) {
+      benchmark::DoNotOptimize(stack.top());
+      stack.pop();
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * depth);
+}
+
+// Keep the stack at a constant depth and push and pop one element on top.
+template <typename StackType>
+static void BM_StackSteadyState(benchmark::State& state) {
+  const int depth = static_cast<int>(state.range(0));
+  StackType stack;
+  for (int i = 0; i < depth; ++i) {
+    stack.push(i);
+  }
+  int value = 0;
+  for (auto _ : state) {
+    stack.push(value++);
+    benchmark::DoNotOptimize(stack.top());
+    stack.pop();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// One alias per backend, so the benchmark names stay readable.
+using VectorStack = s21::Stack<int>;
+using ListStack = s21::Stack<int, s21::List<int>>;
+using HeapListStack = s21::Stack<int, s21::List<int, std::allocator<int>>>;
+using DequeStack = s21::Stack<int, std::deque<int>>;
+using StdStack = std::stack<int>;
+
+#define S21_STACK_BENCHMARK(bench, stack) \
+  BENCHMARK_TEMPLATE(bench, stack)        \
+      ->RangeMultiplier(10)               \
+      ->Range(10, 1000000)                \
+      ->Unit(benchmark::kMicrosecond)
+
+S21_STACK_BENCHMARK(BM_StackFillDrain, VectorStack);
+S21_STACK_BENCHMARK(BM_StackFillDrain, ListStack);
+S21_STACK_BENCHMARK(BM_StackFillDrain, HeapListStack);
+S21_STACK_BENCHMARK(BM_StackFillDrain, DequeStack);
+S21_STACK_BENCHMARK(BM_StackFillDrain, StdStack);
+
+BENCHMARK_TEMPLATE(BM_StackSteadyState, VectorStack)->Range(10, 1000000);
+BENCHMARK_TEMPLATE(BM_StackSteadyState, ListStack)->Range(10, 1000000);
+BENCHMARK_TEMPLATE(BM_StackSteadyState, HeapListStack)->Range(10, 1000000);
+BENCHMARK_TEMPLATE(BM_StackSteadyState, DequeStack)->Range(10, 1000000);
+BENCHMARK_TEMPLATE(BM_StackSteadyState, StdStack)->Range(10, 1000000);
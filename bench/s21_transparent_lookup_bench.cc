@@ -0,0 +1,95 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <map>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../Map/s21_map.h"
+
+using S21Map = s21::Map<std::string, int, std::less<>>;
+using StdMap = std::map<std::string, int, std::less<>>;
+
+constexpr size_t kKeyLength = 21;
+
+// Keys are longer than the small-string buffer, so building a std::string
+// from a view allocates.
+static std::string KeyName(size_t id) {
+  std::string digits = std::to_string(id);
+  return "user:session:" + std::string(8 - digits.size(), '0') + digits;
+}
+
+static std::vector<std::string> MakeKeys(size_t count) {
+  std::vector<std::string> keys(count);
+  for (size_t i = 0; i < count; ++i) {
+    keys[i] = KeyName(i * 2);
+  }
+  std::shuffle(keys.begin(), keys.end(), std::mt19937(42));
+  return keys;
+}
+
+// Views into one buffer, as a parser would hand them out; half miss.
+static std::vector<std::string_view> MakeProbes(const std::string& buffer) {
+  std::vector<std::string_view> probes;
+  for (size_t pos = 0; pos < buffer.size(); pos += kKeyLength) {
+    probes.emplace_back(buffer.data() + pos, kKeyLength);
+  }
+  std::shuffle(probes.begin(), probes.end(), std::mt19937(7));
+  return probes;
+}
+
+static std::string ProbeBuffer(size_t count) {
+  std::string buffer;
+  for (size_t i = 0; i < count; ++i) {
+    buffer += KeyName(i);
+  }
+  return buffer;
+}
+
+template <typename MapType>
+static MapType MakeMap(const std::vector<std::string>& keys) {
+  MapType map;
+  for (const auto& key : keys) {
+    map.insert({key, 1});
+  }
+  return map;
+}
+
+template <typename MapType>
+static void BM_FindViaString(benchmark::State& state) {
+  MapType map = MakeMap<MapType>(MakeKeys(state.range(0)));
+  const std::string buffer = ProbeBuffer(2 * state.range(0));
+  const auto probes = MakeProbes(buffer);
+  for (auto _ : state) {
+    for (std::string_view probe : probes) {
+      benchmark::DoNotOptimize(map.find(std::string(probe)) != map.end());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * probes.size());
+}
+
+template <typename MapType>
+static void BM_FindViaView(benchmark::State& state) {
+  MapType map = MakeMap<MapType>(MakeKeys(state.range(0)));
+  const std::string buffer = ProbeBuffer(2 * state.range(0));
+  const auto probes = MakeProbes(buffer);
+  for (auto _ : state) {
+    for (std::string_view probe : probes) {
+      benchmark::DoNotOptimize(map.find(probe) != map.end());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * probes.size());
+}
+
+#define S21_LOOKUP_BENCHMARK(bench, map) \
+  BENCHMARK_TEMPLATE(bench, map)         \
+      ->RangeMultiplier(8)               \
+      ->Range(1 << 10, 1 << 16)          \
+      ->Unit(benchmark::kMicrosecond)
+
+S21_LOOKUP_BENCHMARK(BM_FindViaString, S21Map);
+S21_LOOKUP_BENCHMARK(BM_FindViaView, S21Map);
+S21_LOOKUP_BENCHMARK(BM_FindViaString, StdMap);
+S21_LOOKUP_BENCHMARK(BM_FindViaView, StdMap);
@@ -0,0 +1,106 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "../Map/s21_map.h"
+#include "../Unordered/s21_unordered_map.h"
+
+using S21UnorderedMap = s21::UnorderedMap<int, int>;
+using StdUnorderedMap = std::unordered_map<int, int>;
+using S21Map = s21::Map<int, int>;
+
+static std::vector<int> RandomKeys(size_t count) {
+  std::vector<int> keys(count);
+  std::iota(keys.begin(), keys.end(), 0);
+  std::shuffle(keys.begin(), keys.end(), std::mt19937(42));
+  return keys;
+}
+
+static void Insert(S21Map& map, int key) { map.insert(key, key); }
+template <typename MapType>
+static void Insert(MapType& map, int key) {
+  map.emplace(key, key);
+}
+
+static bool Contains(StdUnorderedMap& map, int key) { return map.count(key); }
+template <typename MapType>
+static bool Contains(MapType& map, int key) {
+  return map.contains(key);
+}
+
+template <typename MapType>
+static void Erase(MapType& map, int key) {
+  map.erase(key);
+}
+
+template <typename MapType>
+static MapType MakeMap(const std::vector<int>& keys) {
+  MapType map;
+  for (int key : keys) {
+    Insert(map, key);
+  }
+  return map;
+}
+
+template <typename MapType>
+static void BM_HashInsert(benchmark::State& state) {
+  const auto keys = RandomKeys(state.range(0));
+  for (auto _ : state) {
+    MapType map = MakeMap<MapType>(keys);
+    benchmark::DoNotOptimize(map.size());
+  }
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+// Half of the lookups hit, half miss.
+template <typename MapType>
+static void BM_HashFind(benchmark::State& state) {
+  const auto keys = RandomKeys(state.range(0));
+  MapType map = MakeMap<MapType>(keys);
+  std::vector<int> probes(keys.size());
+  std::mt19937 gen(7);
+  for (int& key : probes) {
+    key = static_cast<int>(gen() % (2 * keys.size()));
+  }
+  for (auto _ : state) {
+    for (int key : probes) {
+      benchmark::DoNotOptimize(Contains(map, key));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * probes.size());
+}
+
+// Erases every key and inserts it again, so the size stays put while the
+// table keeps turning slots over.
+template <typename MapType>
+static void BM_HashEraseInsert(benchmark::State& state) {
+  const auto keys = RandomKeys(state.range(0));
+  MapType map = MakeMap<MapType>(keys);
+  for (auto _ : state) {
+    for (int key : keys) {
+      Erase(map, key);
+      Insert(map, key);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+#define S21_HASH_BENCHMARK(bench, map) \
+  BENCHMARK_TEMPLATE(bench, map)       \
+      ->RangeMultiplier(32)            \
+      ->Range(1 << 10, 1 << 20)        \
+      ->Unit(benchmark::kMicrosecond)
+
+S21_HASH_BENCHMARK(BM_HashInsert, S21UnorderedMap);
+S21_HASH_BENCHMARK(BM_HashInsert, StdUnorderedMap);
+S21_HASH_BENCHMARK(BM_HashInsert, S21Map);
+S21_HASH_BENCHMARK(BM_HashFind, S21UnorderedMap);
+S21_HASH_BENCHMARK(BM_HashFind, StdUnorderedMap);
+S21_HASH_BENCHMARK(BM_HashFind, S21Map);
+S21_HASH_BENCHMARK(BM_HashEraseInsert, S21UnorderedMap);
+S21_HASH_BENCHMARK(BM_HashEraseInsert, StdUnorderedMap);
+S21_HASH_BENCHMARK(BM_HashEraseInsert, S21Map);
@@ -0,0 +1,169 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "../Vector/s21_vector.h"
+
+template <typename VectorType>
+static void BM_VectorPushBack(benchmark::State& state) {
+  const int count = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    VectorType vector;
+    for (int i = 0; i < count; ++i) {
+      vector.push_back(i);
+    }
+    benchmark::DoNotOptimize(vector.data());
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+// Every insert lands in the middle, so half of the elements shift each time.
+template <typename VectorType>
+static void BM_VectorInsertMiddle(benchmark::State& state) {
+  const int count = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    VectorType vector;
+    for (int i = 0; i < count; ++i) {
+      vector.insert(vector.begin() + vector.size() / 2, i);
+    }
+    benchmark::DoNotOptimize(vector.data());
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+template <typename VectorType>
+static void BM_VectorEraseMiddle(benchmark::State& state) {
+  const int count = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    VectorType vector;
+    for (int i = 0; i < count; ++i) {
+      vector.push_back(i);
+    }
+    state.ResumeTiming();
+    while (!vector.empty()) {
+      vector.erase(vector.begin() + vector.size() / 2);
+    }
+    benchmark::DoNotOptimize(vector.data());
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+template <typename VectorType>
+static void BM_VectorIterate(benchmark::State& state) {
+  const int count = static_cast<int>(state.range(0));
+  VectorType vector;
+  for (int i = 0; i < count; ++i) {
+    vector.push_back(i);
+  }
+  for (auto _ : state) {
+    long sum = 0;
+    for (auto it = vector.begin(); it != vector.end(); ++it) {
+      sum += *it;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+// Growth with elements that own memory: every reallocation has to move
+// them, copying would duplicate each string.
+template <typename VectorType>
+static void BM_VectorGrowStrings(benchmark::State& state) {
+  const int count = static_cast<int>(state.range(0));
+  const std::string value(64, 'x');
+  for (auto _ : state) {
+    VectorType vector;
+    for (int i = 0; i < count; ++i) {
+      vector.push_back(value);
+    }
+    benchmark::DoNotOptimize(vector.data());
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+template <typename VectorType>
+static void BM_VectorGrowNested(benchmark::State& state) {
+  using Inner = typename VectorType::value_type;
+  const int count = static_cast<int>(state.range(0));
+  const Inner value(16, 1);
+  for (auto _ : state) {
+    VectorType vector;
+    for (int i = 0; i < count; ++i) {
+      vector.push_back(value);
+    }
+    benchmark::DoNotOptimize(vector.data());
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+// Fills a vector using the given growth policy. Besides the time it reports
+// how often the buffer was reallocated, the peak footprint (old and new
+// buffer are both alive while the elements move) and the unused capacity
+// left at the end, all of which do not depend on the iteration.
+template <typename Policy>
+static void BM_VectorGrowthPolicy(benchmark::State& state) {
+  using VectorType = s21::Vector<int, Policy>;
+  const int count = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    VectorType vector;
+    for (int i = 0; i < count; ++i) {
+      vector.push_back(i);
+    }
+    benchmark::DoNotOptimize(vector.data());
+  }
+  VectorType vector;
+  size_t reallocations = 0;
+  size_t peak = 0;
+  for (int i = 0; i < count; ++i) {
+    size_t old_capacity = vector.capacity();
+    vector.push_back(i);
+    if (vector.capacity() != old_capacity) {
+      ++reallocations;
+      peak = std::max(peak, (old_capacity + vector.capacity()) * sizeof(int));
+    }
+  }
+  state.counters["reallocs"] = static_cast<double>(reallocations);
+  state.counters["peak_bytes"] = static_cast<double>(peak);
+  state.counters["slack_bytes"] =
+      static_cast<double>((vector.capacity() - vector.size()) * sizeof(int));
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+BENCHMARK_TEMPLATE(BM_VectorPushBack, s21::Vector<int>)
+    ->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_VectorPushBack, std::vector<int>)
+    ->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_VectorInsertMiddle, s21::Vector<int>)
+    ->Range(1 << 8, 1 << 14);
+BENCHMARK_TEMPLATE(BM_VectorInsertMiddle, std::vector<int>)
+    ->Range(1 << 8, 1 << 14);
+BENCHMARK_TEMPLATE(BM_VectorEraseMiddle, s21::Vector<int>)
+    ->Range(1 << 8, 1 << 14);
+BENCHMARK_TEMPLATE(BM_VectorEraseMiddle, std::vector<int>)
+    ->Range(1 << 8, 1 << 14);
+BENCHMARK_TEMPLATE(BM_VectorIterate, s21::Vector<int>)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_VectorIterate, std::vector<int>)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_VectorGrowStrings, s21::Vector<std::string>)
+    ->Range(1 << 8, 1 << 18);
+BENCHMARK_TEMPLATE(BM_VectorGrowStrings, std::vector<std::string>)
+    ->Range(1 << 8, 1 << 18);
+BENCHMARK_TEMPLATE(BM_VectorGrowNested, s21::Vector<s21::Vector<int>>)
+    ->Range(1 << 8, 1 << 18);
+BENCHMARK_TEMPLATE(BM_VectorGrowNested, std::vector<std::vector<int>>)
+    ->Range(1 << 8, 1 << 18);
+BENCHMARK_TEMPLATE(BM_VectorGrowthPolicy, s21::DoublingGrowth<>)
+    ->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_VectorGrowthPolicy, s21::DoublingGrowth<64>)
+    ->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_VectorGrowthPolicy, s21::OneAndHalfGrowth<>)
+    ->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_VectorGrowthPolicy, s21::FixedStepGrowth<4096>)
+    ->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_VectorGrowthPolicy, s21::PageRoundedGrowth<>)
+    ->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_VectorGrowthPolicy,
+                   s21::PageRoundedGrowth<s21::OneAndHalfGrowth<>>)
+    ->Range(1 << 10, 1 << 20);
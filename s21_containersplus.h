@@ -5,5 +5,12 @@
 #include <iostream>
 
 #include "Array/s21_array.h"
+#include "Flat/s21_flat_map.h"
+#include "Flat/s21_flat_set.h"
+#include "Queue/s21_mpmc_queue.h"
+#include "Queue/s21_spsc_queue.h"
+#include "SmallVector/s21_small_vector.h"
+#include "Unordered/s21_unordered_map.h"
+#include "Unordered/s21_unordered_set.h"
 
 #endif  // S21_CONTAINERSPLUS_H_